@@ -32,6 +32,7 @@ typedef struct {
     PyObject *_co_varnames;
     PyObject *_co_cellvars;
     PyObject *_co_freevars;
+    PyObject *_co_spec_failures;  /* sampled specialization failures */
 } _PyCoCached;
 
 /* Ancillary data structure used for instrumentation.
@@ -102,14 +102,15 @@ backoff_counter_triggers(_Py_BackoffCounter counter)
 }
 
 /* Initial JUMP_BACKWARD counter.
- * This determines when we create a trace for a loop. */
+ * This determines when we create a trace for a loop.
+ * The value is per-interpreter (see jump_backward_initial_value in
+ * PyInterpreterState) and can be lowered with PYTHON_JIT_THRESHOLD. */
 #define JUMP_BACKWARD_INITIAL_VALUE 4095
 #define JUMP_BACKWARD_INITIAL_BACKOFF 12
 static inline _Py_BackoffCounter
-initial_jump_backoff_counter(void)
+initial_jump_backoff_counter(uint16_t value)
 {
-    return make_backoff_counter(JUMP_BACKWARD_INITIAL_VALUE,
-                                JUMP_BACKWARD_INITIAL_BACKOFF);
+    return make_backoff_counter(value, JUMP_BACKWARD_INITIAL_BACKOFF);
 }
 
 /* Initial exit temperature.
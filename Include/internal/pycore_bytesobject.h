@@ -23,6 +23,9 @@ extern PyObject* _PyBytes_FromHex(
 PyAPI_FUNC(PyObject*) _PyBytes_DecodeEscape(const char *, Py_ssize_t,
                                             const char *, const char **);
 
+// Return 1 if two bytes objects are equal, 0 otherwise.
+PyAPI_FUNC(int) _PyBytes_Equal(PyObject *, PyObject *);
+
 
 // Substring Search.
 //
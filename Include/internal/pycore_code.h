@@ -67,10 +67,24 @@ _py_set_opcode(_Py_CODEUNIT *word, uint8_t opcode)
 #define _PyCode_HAS_INSTRUMENTATION(CODE) \
     (CODE->_co_instrumentation_version > 0)
 
+// Number of SPEC_FAIL_* kinds in Python/specialize.c
+#define SPEC_FAILURE_KINDS 36
+
+// Specialization failures sampled at runtime, in every build.
+// See _opcode.set_specialization_failure_sampling().
+struct _Py_spec_failure_state {
+    // Record one in every sample_rate failures, 0 when disabled
+    int sample_rate;
+    int countdown;
+    // Failures per generic opcode and SPEC_FAIL_* kind
+    uint64_t (*counts)[SPEC_FAILURE_KINDS];
+};
+
 struct _py_code_state {
     PyMutex mutex;
     // Interned constants from code objects. Used by the free-threaded build.
     struct _Py_hashtable_t *constants;
+    struct _Py_spec_failure_state spec_failures;
 };
 
 extern PyStatus _PyCode_Init(PyInterpreterState *interp);
@@ -146,7 +160,20 @@ typedef struct {
 } _PyLoadMethodCache;
 
 
-// MUST be the max(_PyAttrCache, _PyLoadMethodCache)
+/* LOAD_ATTR_POLYMORPHIC caches up to three receiver types. Each shape is
+ * a byte holding the offset of the attribute in words from the start of the
+ * object, or'ed with POLYMORPHIC_SHAPE_INLINE_VALUES for inline values. */
+#define LOAD_ATTR_POLYMORPHIC_SHAPES 3
+#define POLYMORPHIC_SHAPE_INLINE_VALUES 0x80
+#define POLYMORPHIC_SHAPE_MAX_OFFSET 0x7f
+
+typedef struct {
+    _Py_BackoffCounter counter;
+    uint16_t type_versions[LOAD_ATTR_POLYMORPHIC_SHAPES][2];  // 0 if unused
+    uint16_t shapes[2];
+} _PyAttrPolymorphicCache;
+
+// MUST be the max(_PyAttrCache, _PyLoadMethodCache, _PyAttrPolymorphicCache)
 #define INLINE_CACHE_ENTRIES_LOAD_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
 #define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyAttrCache)
@@ -159,6 +186,12 @@ typedef struct {
 #define INLINE_CACHE_ENTRIES_CALL CACHE_ENTRIES(_PyCallCache)
 #define INLINE_CACHE_ENTRIES_CALL_KW CACHE_ENTRIES(_PyCallCache)
 
+typedef struct {
+    _Py_BackoffCounter counter;
+} _PyCallFunctionExCache;
+
+#define INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX CACHE_ENTRIES(_PyCallFunctionExCache)
+
 typedef struct {
     _Py_BackoffCounter counter;
 } _PyStoreSubscrCache;
@@ -345,6 +378,7 @@ extern void _Py_Specialize_Call(_PyStackRef callable, _Py_CODEUNIT *instr,
                                 int nargs);
 extern void _Py_Specialize_CallKw(_PyStackRef callable, _Py_CODEUNIT *instr,
                                   int nargs);
+extern void _Py_Specialize_CallFunctionEx(_PyStackRef func, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_BinaryOp(_PyStackRef lhs, _PyStackRef rhs, _Py_CODEUNIT *instr,
                                     int oparg, _PyStackRef *locals);
 extern void _Py_Specialize_CompareOp(_PyStackRef lhs, _PyStackRef rhs,
@@ -356,6 +390,13 @@ extern void _Py_Specialize_Send(_PyStackRef receiver, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_ToBool(_PyStackRef value, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_ContainsOp(_PyStackRef value, _Py_CODEUNIT *instr);
 
+// Export for '_opcode' shared extension
+PyAPI_FUNC(int) _Py_SetSpecializationFailureSampling(int sample_rate);
+PyAPI_FUNC(PyObject *) _Py_GetSpecializationFailures(void);
+PyAPI_FUNC(PyObject *) _PyCode_GetSpecializationFailures(PyCodeObject *co);
+extern int _PyCode_RecordSpecializationFailure(PyCodeObject *co, int offset,
+                                               int kind);
+
 #ifdef Py_STATS
 
 #include "pycore_bitutils.h"  // _Py_bit_length
@@ -133,12 +133,23 @@ extern int _PyDict_GetItemRef_KnownHash(PyDictObject *op, PyObject *key, Py_hash
 extern int _PyDict_GetItemRef_Unicode_LockHeld(PyDictObject *op, PyObject *key, PyObject **result);
 extern int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject *obj, PyObject **dictptr, PyObject *name, PyObject *value);
 
+// Like dict.__getitem__() (including the __missing__() hook of subclasses),
+// but return 0 instead of raising KeyError if the key is missing.
+extern int _PyDict_GetOptionalSubscript(PyObject *op, PyObject *key, PyObject **result);
+// Return true if the type uses dict.__getitem__() unchanged.
+extern int _PyDict_HasDefaultSubscript(PyTypeObject *type);
+
 extern int _PyDict_Pop_KnownHash(
     PyDictObject *dict,
     PyObject *key,
     Py_hash_t hash,
     PyObject **result);
 
+// Advance a dict item iterator without packing the item into a tuple.
+// Returns 1 and new references to the key and value, or 0 where tp_iternext
+// would return NULL.
+PyAPI_FUNC(int) _PyDictIter_NextItem(PyObject *self, PyObject **key, PyObject **value);
+
 #define DKIX_EMPTY (-1)
 #define DKIX_DUMMY (-2)  /* Used internally */
 #define DKIX_ERROR (-3)
@@ -89,12 +89,13 @@ static inline int _PyObject_GC_IS_TRACKED(PyObject *op) {
 #define _PyObject_GC_IS_TRACKED(op) _PyObject_GC_IS_TRACKED(_Py_CAST(PyObject*, op))
 
 /* True if the object may be tracked by the GC in the future, or already is.
-   This can be useful to implement some optimizations. */
+   This can be useful to implement some optimizations.  Tuples and frozensets
+   are immutable, so once untracked they stay untracked. */
 static inline int _PyObject_GC_MAY_BE_TRACKED(PyObject *obj) {
     if (!PyObject_IS_GC(obj)) {
         return 0;
     }
-    if (PyTuple_CheckExact(obj)) {
+    if (PyTuple_CheckExact(obj) || PyFrozenSet_CheckExact(obj)) {
         return _PyObject_GC_IS_TRACKED(obj);
     }
     return 1;
@@ -149,6 +150,7 @@ static inline void _PyObject_GC_SET_SHARED(PyObject *op) {
 #define _PyGC_DEBUG_COLLECTABLE       (1<<1) /* print collectable objects */
 #define _PyGC_DEBUG_UNCOLLECTABLE     (1<<2) /* print uncollectable objects */
 #define _PyGC_DEBUG_SAVEALL           (1<<5) /* save all garbage in gc.garbage */
+#define _PyGC_DEBUG_TYPE_STATS        (1<<6) /* record per-type statistics */
 #define _PyGC_DEBUG_LEAK              _PyGC_DEBUG_COLLECTABLE | \
                                       _PyGC_DEBUG_UNCOLLECTABLE | \
                                       _PyGC_DEBUG_SAVEALL
@@ -284,6 +286,16 @@ struct gc_generation_stats {
     Py_ssize_t uncollectable;
 };
 
+/* Running stats per type (recorded with DEBUG_TYPE_STATS) */
+struct gc_type_stats {
+    /* number of objects visited by a collection */
+    Py_ssize_t traversed;
+    /* number of objects found reachable by a collection */
+    Py_ssize_t survived;
+    /* number of objects collected */
+    Py_ssize_t collected;
+};
+
 enum _GCPhase {
     GC_PHASE_MARK = 0,
     GC_PHASE_COLLECT = 1
@@ -311,6 +323,9 @@ struct _gc_runtime_state {
     PyObject *garbage;
     /* a list of callbacks to be invoked when collection is performed */
     PyObject *callbacks;
+    /* per-type statistics, mapping types (borrowed references) to
+       struct gc_type_stats; NULL until DEBUG_TYPE_STATS is first used */
+    struct _Py_hashtable_t *type_stats;
 
     Py_ssize_t heap_size;
     Py_ssize_t work_to_do;
@@ -330,6 +345,20 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+    /* Number of threads that mark the heap in parallel during a
+       collection (set from PYTHON_GC_THREADS; 1 means serial). */
+    int parallel_threads;
+    /* The threads that help the collecting thread, started by the first
+       parallel collection, or NULL */
+    struct _gc_worker_pool *worker_pool;
+    /* Protects type_stats */
+    PyMutex type_stats_mutex;
+#else
+    /* Objects marked by the background marking thread whose referents
+       have not been marked yet. */
+    PyGC_Head background_reachable;
+    /* The background marking thread (PYTHON_GC_BACKGROUND_MARK), or NULL */
+    struct _gc_background_marker *background_marker;
 #endif
 };
 
@@ -352,15 +381,39 @@ extern void _PyGC_Freeze(PyInterpreterState *interp);
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 /* Number of frozen objects */
 extern Py_ssize_t _PyGC_GetFreezeCount(PyInterpreterState *interp);
+/* Make the objects tracked by the GC, and the objects they refer to,
+   immortal. Returns the number of objects made immortal. */
+extern Py_ssize_t _PyGC_Immortalize(PyThreadState *tstate);
 
 extern PyObject *_PyGC_GetObjects(PyInterpreterState *interp, int generation);
 extern PyObject *_PyGC_GetReferrers(PyInterpreterState *interp, PyObject *objs);
+/* Snapshot of the per-type statistics: {type: {"traversed": n, ...}} */
+extern PyObject *_PyGC_GetTypeStats(PyInterpreterState *interp, int reset);
+/* Forget the statistics of a type that is being deallocated */
+extern void _PyGC_RemoveTypeStats(PyInterpreterState *interp,
+                                  PyTypeObject *type);
 
 // Functions to clear types free lists
 extern void _PyGC_ClearAllFreeLists(PyInterpreterState *interp);
 extern void _Py_ScheduleGC(PyThreadState *tstate);
 extern void _Py_RunGC(PyThreadState *tstate);
 
+#ifndef Py_GIL_DISABLED
+// Stop the background marking thread, if any (PYTHON_GC_BACKGROUND_MARK)
+extern void _PyGC_FiniBackgroundMarking(PyInterpreterState *interp);
+PyAPI_FUNC(void) _PyGC_AfterForkBackgroundMarking(PyInterpreterState *interp);
+#else
+#  define _PyGC_FiniBackgroundMarking(A) ((void)0)
+#  define _PyGC_AfterForkBackgroundMarking(A) ((void)0)
+#endif
+
+#ifdef Py_GIL_DISABLED
+// Forget the threads that mark the heap in parallel (PYTHON_GC_THREADS)
+PyAPI_FUNC(void) _PyGC_AfterForkWorkerPool(PyInterpreterState *interp);
+#else
+#  define _PyGC_AfterForkWorkerPool(A) ((void)0)
+#endif
+
 union _PyStackRef;
 
 // GC visit callback for tracked interpreter frames
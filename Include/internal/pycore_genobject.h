@@ -16,16 +16,17 @@ extern "C" {
     PyObject_HEAD                                                           \
     /* List of weak reference. */                                           \
     PyObject *prefix##_weakreflist;                                         \
-    /* Name of the generator. */                                            \
-    PyObject *prefix##_name;                                                \
-    /* Qualified name of the generator. */                                  \
-    PyObject *prefix##_qualname;                                            \
+    /* (name, qualname) tuple, or NULL if the generator uses the names      \
+       of its code object, which is almost always the case. */              \
+    PyObject *prefix##_names;                                               \
     _PyErr_StackItem prefix##_exc_state;                                    \
     PyObject *prefix##_origin_or_finalizer;                                 \
     char prefix##_hooks_inited;                                             \
     char prefix##_closed;                                                   \
     char prefix##_running_async;                                            \
-    /* The frame */                                                         \
+    /* The frame. It is embedded at full size for the code's stack depth:   \
+       _PyGen_GetGeneratorFromFrame() relies on its offset, so it cannot    \
+       be allocated lazily. */                                              \
     int8_t prefix##_frame_state;                                            \
     struct _PyInterpreterFrame prefix##_iframe;                             \
 
@@ -54,6 +55,8 @@ PyGenObject *_PyGen_GetGeneratorFromFrame(_PyInterpreterFrame *frame)
 
 PyAPI_FUNC(PyObject *)_PyGen_yf(PyGenObject *);
 extern void _PyGen_Finalize(PyObject *self);
+// Returns a borrowed reference.
+extern PyObject *_PyGen_GetQualname(PyGenObject *gen);
 
 // Export for '_asyncio' shared extension
 PyAPI_FUNC(int) _PyGen_SetStopIterationValue(PyObject *);
@@ -265,6 +265,8 @@ struct _is {
     _PyOptimizerObject *optimizer;
     _PyExecutorObject *executor_list_head;
     size_t trace_run_counter;
+    uint16_t jump_backward_initial_value;
+    struct _PyJITQueue *jit_queue;  // NULL unless compiling in the background
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
 
@@ -16,6 +16,28 @@ typedef _Py_CODEUNIT *(*jit_func)(_PyInterpreterFrame *frame, _PyStackRef *stack
 int _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction *trace, size_t length);
 void _PyJIT_Free(_PyExecutorObject *executor);
 
+// Machine code compiled for an executor on a thread without an attached
+// thread state. Errors can't be raised there, so they are recorded here and
+// raised when the code is attached to the executor.
+typedef struct {
+    unsigned char *memory;
+    size_t size;
+    const char *error;
+    int error_hint;
+} _PyJITCode;
+
+int _PyJIT_CompileDetached(_PyExecutorObject *executor, const _PyUOpInstruction *trace, size_t length, _PyJITCode *code);
+int _PyJIT_Attach(_PyExecutorObject *executor, _PyJITCode *code);
+void _PyJIT_Discard(_PyJITCode *code);
+
+// Executable memory is shared between executors, and only returned to the
+// OS in batches, by this:
+void _PyJIT_ReleaseUnusedMemory(void);
+// Whether the executor's code is keeping otherwise unused memory alive:
+bool _PyJIT_IsStranded(_PyExecutorObject *executor);
+// Releases the executable memory at runtime finalization:
+void _PyJIT_Fini(void);
+
 #endif  // _Py_JIT
 
 #ifdef __cplusplus
@@ -264,6 +264,8 @@ Known values:
     Python 3.14a2 3609 (Add LOAD_SMALL_INT and LOAD_CONST_IMMORTAL instructions, remove RETURN_CONST)
                        (3610 accidentally omitted)
     Python 3.14a4 3611 (Add NOT_TAKEN instruction)
+    Python 3.14a4 3612 (Add an inline cache to CALL_FUNCTION_EX)
+    Python 3.14a4 3613 (Move RESUME to 128 to make room for specializations)
 
     Python 3.15 will start with 3650
 
@@ -276,7 +278,7 @@ PC/launcher.c must also be updated.
 
 */
 
-#define PYC_MAGIC_NUMBER 3611
+#define PYC_MAGIC_NUMBER 3613
 /* This is equivalent to converting PYC_MAGIC_NUMBER to 2 bytes
    (little-endian) and then appending b'\r\n'. */
 #define PYC_MAGIC_NUMBER_TOKEN \
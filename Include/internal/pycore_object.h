@@ -961,6 +961,13 @@ extern int _PyObject_IsAbstract(PyObject *);
 PyAPI_FUNC(int) _PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method);
 extern PyObject* _PyObject_NextNotImplemented(PyObject *);
 
+// Advance an enumerate or two-argument zip object without packing the result
+// into a tuple. Return 1 and two new references, or 0 where tp_iternext would
+// return NULL.
+PyAPI_FUNC(int) _PyEnum_NextPair(PyObject *self, PyObject **index, PyObject **item);
+PyAPI_FUNC(int) _PyZip_IsPair(PyObject *self);
+PyAPI_FUNC(int) _PyZip_NextPair(PyObject *self, PyObject **first, PyObject **second);
+
 // Pickle support.
 // Export for '_datetime' shared extension
 PyAPI_FUNC(PyObject*) _PyObject_GetState(PyObject *);
@@ -34,6 +34,8 @@ typedef struct {
     uint8_t chain_depth:6;  // Must be big enough for MAX_CHAIN_DEPTH - 1.
     bool warm;
     int index;           // Index of ENTER_EXECUTOR (if code isn't NULL, below).
+    uint64_t entries;    // Times the executor was entered
+    uint64_t deopts;     // Times it returned to tier one through a deopt
     _PyBloomFilter bloom;
     _PyExecutorLinkListNode links;
     PyCodeObject *code;  // Weak (NULL if no corresponding ENTER_EXECUTOR).
@@ -69,6 +71,7 @@ typedef struct {
     uint32_t target;
     _Py_BackoffCounter temperature;
     const struct _PyExecutorObject *executor;
+    uint64_t taken;
 } _PyExitData;
 
 typedef struct _PyExecutorObject {
@@ -130,10 +133,16 @@ PyAPI_FUNC(void) _Py_Executors_InvalidateDependency(PyInterpreterState *interp,
 PyAPI_FUNC(void) _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation);
 PyAPI_FUNC(void) _Py_Executors_InvalidateCold(PyInterpreterState *interp);
 
+extern int _PyOptimizer_InitBackgroundCompiler(PyInterpreterState *interp);
+extern void _PyOptimizer_FiniBackgroundCompiler(PyInterpreterState *interp);
+PyAPI_FUNC(void) _PyOptimizer_AfterForkBackgroundCompiler(PyInterpreterState *interp);
+
 #else
 #  define _Py_Executors_InvalidateDependency(A, B, C) ((void)0)
 #  define _Py_Executors_InvalidateAll(A, B) ((void)0)
 #  define _Py_Executors_InvalidateCold(A) ((void)0)
+#  define _PyOptimizer_FiniBackgroundCompiler(A) ((void)0)
+#  define _PyOptimizer_AfterForkBackgroundCompiler(A) ((void)0)
 
 #endif
 
@@ -289,6 +298,7 @@ static inline int is_terminator(const _PyUOpInstruction *uop)
 }
 
 PyAPI_FUNC(int) _PyDumpExecutors(FILE *out);
+extern PyObject *_PyExecutor_GetStats(PyInterpreterState *interp);
 
 #ifdef __cplusplus
 }
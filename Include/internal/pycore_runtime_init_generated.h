@@ -1157,6 +1157,7 @@ extern "C" {
     INIT_ID(ps2), \
     INIT_ID(query), \
     INIT_ID(quotetabs), \
+    INIT_ID(rate), \
     INIT_ID(raw), \
     INIT_ID(read), \
     INIT_ID(read1), \
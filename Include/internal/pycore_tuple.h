@@ -23,6 +23,8 @@ extern PyStatus _PyTuple_InitGlobalObjects(PyInterpreterState *);
 PyAPI_FUNC(PyObject *)_PyTuple_FromArray(PyObject *const *, Py_ssize_t);
 PyAPI_FUNC(PyObject *)_PyTuple_FromStackRefSteal(const union _PyStackRef *, Py_ssize_t);
 PyAPI_FUNC(PyObject *)_PyTuple_FromArraySteal(PyObject *const *, Py_ssize_t);
+PyAPI_FUNC(PyObject *)_PyTuple_RichCompare(PyObject *, PyObject *, int);
+PyAPI_FUNC(int) _PyTuple_Contains(PyObject *, PyObject *);
 
 typedef struct {
     PyObject_HEAD
@@ -225,6 +225,11 @@ extern PyObject * _PyType_GetMRO(PyTypeObject *type);
 extern PyObject* _PyType_GetSubclasses(PyTypeObject *);
 extern int _PyType_HasSubclasses(PyTypeObject *);
 
+// The type itself, or its nearest base whose tp_traverse isn't the one of
+// classes: the tp_traverse that the objects of type end up calling, after
+// visiting their slots, dict and type.
+extern PyTypeObject * _PyType_GetTraverseBase(PyTypeObject *type);
+
 // Export for _testinternalcapi extension.
 PyAPI_FUNC(PyObject *) _PyType_GetSlotWrapperNames(void);
 
@@ -209,6 +209,12 @@ PyAPI_FUNC(PyObject*) _PyUnicode_JoinArray(
     Py_ssize_t seqlen
     );
 
+PyAPI_FUNC(PyObject*) _PyUnicode_JoinFormatted(
+    PyObject *const *items,
+    Py_ssize_t seqlen,
+    uint64_t format_mask
+    );
+
 /* Test whether a unicode is equal to ASCII identifier.  Return 1 if true,
    0 otherwise.  The right argument must be ASCII identifier.
    Any error occurs inside will be cleared before return. */
@@ -80,6 +80,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_GUARD_BOTH_UNICODE] = HAS_EXIT_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_GUARD_UNICODE_FORMAT] = HAS_EXIT_FLAG,
+    [_BINARY_OP_REMAINDER_UNICODE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
     [_BINARY_SUBSCR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -134,6 +136,7 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_STORE_DEREF] = HAS_ARG_FLAG | HAS_FREE_FLAG | HAS_ESCAPES_FLAG,
     [_COPY_FREE_VARS] = HAS_ARG_FLAG,
     [_BUILD_STRING] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
+    [_BUILD_STRING_FORMAT] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BUILD_TUPLE] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_BUILD_LIST] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_LIST_EXTEND] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -153,6 +156,10 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_INSTANCE_VALUE_0] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE_1] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_OPARG_AND_1_FLAG,
+    [_GUARD_SHAPE_VERSION_0] = 0,
+    [_GUARD_SHAPE_VERSION_1] = 0,
+    [_GUARD_SHAPE_VERSION_2] = 0,
+    [_LOAD_ATTR_POLYMORPHIC] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_CHECK_ATTR_MODULE_PUSH_KEYS] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_MODULE_FROM_KEYS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_CHECK_ATTR_WITH_HINT] = HAS_EXIT_FLAG,
@@ -173,10 +180,14 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_COMPARE_OP_FLOAT] = HAS_ARG_FLAG,
     [_COMPARE_OP_INT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_COMPARE_OP_STR] = HAS_ARG_FLAG,
+    [_COMPARE_OP_INT_FLOAT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_BYTES] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
+    [_COMPARE_OP_TUPLE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_IS_OP] = HAS_ARG_FLAG,
     [_CONTAINS_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CONTAINS_OP_SET] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CONTAINS_OP_DICT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CONTAINS_OP_TUPLE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_EG_MATCH] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_EXC_MATCH] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_IMPORT_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -200,6 +211,12 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_GUARD_NOT_EXHAUSTED_RANGE] = HAS_EXIT_FLAG,
     [_ITER_NEXT_RANGE] = HAS_ERROR_FLAG,
     [_FOR_ITER_GEN_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_ITER_CHECK_DICT_ITEMS] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_ENUMERATE] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_ZIP] = HAS_EXIT_FLAG,
+    [_FOR_ITER_DICT_ITEMS_UNPACKED] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_FOR_ITER_ENUMERATE_UNPACKED] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_FOR_ITER_ZIP_UNPACKED] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_SPECIAL] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_WITH_EXCEPT_START] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_PUSH_EXC_INFO] = 0,
@@ -255,7 +272,11 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_EXPAND_METHOD_KW] = HAS_ARG_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_KW_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_BUILTIN_FAST] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_CALLARGS_A_TUPLE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_CHECK_IS_NOT_PY_CALLABLE_EX] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_CALL_FUNCTION_EX_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_FUNCTION] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_SET_FUNCTION_ATTRIBUTE] = HAS_ARG_FLAG,
     [_RETURN_GENERATOR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -279,9 +300,15 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_CONST_INLINE] = HAS_PURE_FLAG,
     [_LOAD_CONST_INLINE_BORROW] = HAS_PURE_FLAG,
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = HAS_PURE_FLAG,
+    [_ENTER_INLINED] = HAS_ARG_FLAG,
+    [_RETURN_INLINED] = HAS_ARG_FLAG,
+    [_ENTER_GUARDED_INLINED] = 0,
+    [_RETURN_GUARDED_INLINED] = HAS_ARG_FLAG,
+    [_MATERIALIZE_INLINED_FRAME] = HAS_ARG_FLAG,
     [_LOAD_CONST_INLINE_WITH_NULL] = HAS_PURE_FLAG,
     [_LOAD_CONST_INLINE_BORROW_WITH_NULL] = HAS_PURE_FLAG,
     [_CHECK_FUNCTION] = HAS_DEOPT_FLAG,
+    [_GUARD_LOCAL_TYPE_VERSION] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_EXIT_FLAG,
     [_LOAD_GLOBAL_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_BUILTINS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_ATTR_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
@@ -311,6 +338,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
     [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
+    [_BINARY_OP_REMAINDER_UNICODE] = "_BINARY_OP_REMAINDER_UNICODE",
     [_BINARY_OP_SUBTRACT_FLOAT] = "_BINARY_OP_SUBTRACT_FLOAT",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
     [_BINARY_SLICE] = "_BINARY_SLICE",
@@ -326,14 +354,18 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_BUILD_SET] = "_BUILD_SET",
     [_BUILD_SLICE] = "_BUILD_SLICE",
     [_BUILD_STRING] = "_BUILD_STRING",
+    [_BUILD_STRING_FORMAT] = "_BUILD_STRING_FORMAT",
     [_BUILD_TUPLE] = "_BUILD_TUPLE",
     [_CALL_BUILTIN_CLASS] = "_CALL_BUILTIN_CLASS",
     [_CALL_BUILTIN_FAST] = "_CALL_BUILTIN_FAST",
     [_CALL_BUILTIN_FAST_WITH_KEYWORDS] = "_CALL_BUILTIN_FAST_WITH_KEYWORDS",
     [_CALL_BUILTIN_O] = "_CALL_BUILTIN_O",
+    [_CALL_FUNCTION_EX_NON_PY] = "_CALL_FUNCTION_EX_NON_PY",
     [_CALL_INTRINSIC_1] = "_CALL_INTRINSIC_1",
     [_CALL_INTRINSIC_2] = "_CALL_INTRINSIC_2",
     [_CALL_ISINSTANCE] = "_CALL_ISINSTANCE",
+    [_CALL_KW_BUILTIN_FAST] = "_CALL_KW_BUILTIN_FAST",
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = "_CALL_KW_METHOD_DESCRIPTOR_FAST",
     [_CALL_KW_NON_PY] = "_CALL_KW_NON_PY",
     [_CALL_LEN] = "_CALL_LEN",
     [_CALL_LIST_APPEND] = "_CALL_LIST_APPEND",
@@ -359,6 +391,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CHECK_FUNCTION_VERSION_INLINE] = "_CHECK_FUNCTION_VERSION_INLINE",
     [_CHECK_FUNCTION_VERSION_KW] = "_CHECK_FUNCTION_VERSION_KW",
     [_CHECK_IS_NOT_PY_CALLABLE] = "_CHECK_IS_NOT_PY_CALLABLE",
+    [_CHECK_IS_NOT_PY_CALLABLE_EX] = "_CHECK_IS_NOT_PY_CALLABLE_EX",
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = "_CHECK_IS_NOT_PY_CALLABLE_KW",
     [_CHECK_MANAGED_OBJECT_HAS_VALUES] = "_CHECK_MANAGED_OBJECT_HAS_VALUES",
     [_CHECK_METHOD_VERSION] = "_CHECK_METHOD_VERSION",
@@ -371,12 +404,16 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CHECK_VALIDITY] = "_CHECK_VALIDITY",
     [_CHECK_VALIDITY_AND_SET_IP] = "_CHECK_VALIDITY_AND_SET_IP",
     [_COMPARE_OP] = "_COMPARE_OP",
+    [_COMPARE_OP_BYTES] = "_COMPARE_OP_BYTES",
     [_COMPARE_OP_FLOAT] = "_COMPARE_OP_FLOAT",
     [_COMPARE_OP_INT] = "_COMPARE_OP_INT",
+    [_COMPARE_OP_INT_FLOAT] = "_COMPARE_OP_INT_FLOAT",
     [_COMPARE_OP_STR] = "_COMPARE_OP_STR",
+    [_COMPARE_OP_TUPLE] = "_COMPARE_OP_TUPLE",
     [_CONTAINS_OP] = "_CONTAINS_OP",
     [_CONTAINS_OP_DICT] = "_CONTAINS_OP_DICT",
     [_CONTAINS_OP_SET] = "_CONTAINS_OP_SET",
+    [_CONTAINS_OP_TUPLE] = "_CONTAINS_OP_TUPLE",
     [_CONVERT_VALUE] = "_CONVERT_VALUE",
     [_COPY] = "_COPY",
     [_COPY_FREE_VARS] = "_COPY_FREE_VARS",
@@ -392,6 +429,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_DICT_UPDATE] = "_DICT_UPDATE",
     [_DYNAMIC_EXIT] = "_DYNAMIC_EXIT",
     [_END_SEND] = "_END_SEND",
+    [_ENTER_GUARDED_INLINED] = "_ENTER_GUARDED_INLINED",
+    [_ENTER_INLINED] = "_ENTER_INLINED",
     [_ERROR_POP_N] = "_ERROR_POP_N",
     [_EXIT_INIT_CHECK] = "_EXIT_INIT_CHECK",
     [_EXIT_TRACE] = "_EXIT_TRACE",
@@ -400,8 +439,11 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_FATAL_ERROR] = "_FATAL_ERROR",
     [_FORMAT_SIMPLE] = "_FORMAT_SIMPLE",
     [_FORMAT_WITH_SPEC] = "_FORMAT_WITH_SPEC",
+    [_FOR_ITER_DICT_ITEMS_UNPACKED] = "_FOR_ITER_DICT_ITEMS_UNPACKED",
+    [_FOR_ITER_ENUMERATE_UNPACKED] = "_FOR_ITER_ENUMERATE_UNPACKED",
     [_FOR_ITER_GEN_FRAME] = "_FOR_ITER_GEN_FRAME",
     [_FOR_ITER_TIER_TWO] = "_FOR_ITER_TIER_TWO",
+    [_FOR_ITER_ZIP_UNPACKED] = "_FOR_ITER_ZIP_UNPACKED",
     [_GET_AITER] = "_GET_AITER",
     [_GET_ANEXT] = "_GET_ANEXT",
     [_GET_AWAITABLE] = "_GET_AWAITABLE",
@@ -421,15 +463,20 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_GUARD_IS_NOT_NONE_POP] = "_GUARD_IS_NOT_NONE_POP",
     [_GUARD_IS_TRUE_POP] = "_GUARD_IS_TRUE_POP",
     [_GUARD_KEYS_VERSION] = "_GUARD_KEYS_VERSION",
+    [_GUARD_LOCAL_TYPE_VERSION] = "_GUARD_LOCAL_TYPE_VERSION",
     [_GUARD_NOS_FLOAT] = "_GUARD_NOS_FLOAT",
     [_GUARD_NOS_INT] = "_GUARD_NOS_INT",
     [_GUARD_NOT_EXHAUSTED_LIST] = "_GUARD_NOT_EXHAUSTED_LIST",
     [_GUARD_NOT_EXHAUSTED_RANGE] = "_GUARD_NOT_EXHAUSTED_RANGE",
     [_GUARD_NOT_EXHAUSTED_TUPLE] = "_GUARD_NOT_EXHAUSTED_TUPLE",
+    [_GUARD_SHAPE_VERSION_0] = "_GUARD_SHAPE_VERSION_0",
+    [_GUARD_SHAPE_VERSION_1] = "_GUARD_SHAPE_VERSION_1",
+    [_GUARD_SHAPE_VERSION_2] = "_GUARD_SHAPE_VERSION_2",
     [_GUARD_TOS_FLOAT] = "_GUARD_TOS_FLOAT",
     [_GUARD_TOS_INT] = "_GUARD_TOS_INT",
     [_GUARD_TYPE_VERSION] = "_GUARD_TYPE_VERSION",
     [_GUARD_TYPE_VERSION_AND_LOCK] = "_GUARD_TYPE_VERSION_AND_LOCK",
+    [_GUARD_UNICODE_FORMAT] = "_GUARD_UNICODE_FORMAT",
     [_IMPORT_FROM] = "_IMPORT_FROM",
     [_IMPORT_NAME] = "_IMPORT_NAME",
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = "_INIT_CALL_BOUND_METHOD_EXACT_ARGS",
@@ -442,9 +489,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_INTERNAL_INCREMENT_OPT_COUNTER] = "_INTERNAL_INCREMENT_OPT_COUNTER",
     [_IS_NONE] = "_IS_NONE",
     [_IS_OP] = "_IS_OP",
+    [_ITER_CHECK_DICT_ITEMS] = "_ITER_CHECK_DICT_ITEMS",
+    [_ITER_CHECK_ENUMERATE] = "_ITER_CHECK_ENUMERATE",
     [_ITER_CHECK_LIST] = "_ITER_CHECK_LIST",
     [_ITER_CHECK_RANGE] = "_ITER_CHECK_RANGE",
     [_ITER_CHECK_TUPLE] = "_ITER_CHECK_TUPLE",
+    [_ITER_CHECK_ZIP] = "_ITER_CHECK_ZIP",
     [_ITER_NEXT_LIST] = "_ITER_NEXT_LIST",
     [_ITER_NEXT_RANGE] = "_ITER_NEXT_RANGE",
     [_ITER_NEXT_TUPLE] = "_ITER_NEXT_TUPLE",
@@ -465,6 +515,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_MODULE_FROM_KEYS] = "_LOAD_ATTR_MODULE_FROM_KEYS",
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT",
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES",
+    [_LOAD_ATTR_POLYMORPHIC] = "_LOAD_ATTR_POLYMORPHIC",
     [_LOAD_ATTR_PROPERTY_FRAME] = "_LOAD_ATTR_PROPERTY_FRAME",
     [_LOAD_ATTR_SLOT] = "_LOAD_ATTR_SLOT",
     [_LOAD_ATTR_SLOT_0] = "_LOAD_ATTR_SLOT_0",
@@ -516,6 +567,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_MATCH_KEYS] = "_MATCH_KEYS",
     [_MATCH_MAPPING] = "_MATCH_MAPPING",
     [_MATCH_SEQUENCE] = "_MATCH_SEQUENCE",
+    [_MATERIALIZE_INLINED_FRAME] = "_MATERIALIZE_INLINED_FRAME",
     [_MAYBE_EXPAND_METHOD] = "_MAYBE_EXPAND_METHOD",
     [_MAYBE_EXPAND_METHOD_KW] = "_MAYBE_EXPAND_METHOD_KW",
     [_NOP] = "_NOP",
@@ -530,6 +582,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_REPLACE_WITH_TRUE] = "_REPLACE_WITH_TRUE",
     [_RESUME_CHECK] = "_RESUME_CHECK",
     [_RETURN_GENERATOR] = "_RETURN_GENERATOR",
+    [_RETURN_GUARDED_INLINED] = "_RETURN_GUARDED_INLINED",
+    [_RETURN_INLINED] = "_RETURN_INLINED",
     [_RETURN_VALUE] = "_RETURN_VALUE",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
     [_SEND_GEN_FRAME] = "_SEND_GEN_FRAME",
@@ -705,6 +759,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _BINARY_OP_ADD_UNICODE:
             return 2;
+        case _GUARD_UNICODE_FORMAT:
+            return 0;
+        case _BINARY_OP_REMAINDER_UNICODE:
+            return 2;
         case _BINARY_OP_INPLACE_ADD_UNICODE:
             return 2;
         case _BINARY_SUBSCR:
@@ -813,6 +871,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _BUILD_STRING:
             return oparg;
+        case _BUILD_STRING_FORMAT:
+            return oparg;
         case _BUILD_TUPLE:
             return oparg;
         case _BUILD_LIST:
@@ -851,6 +911,14 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _LOAD_ATTR_INSTANCE_VALUE:
             return 1;
+        case _GUARD_SHAPE_VERSION_0:
+            return 0;
+        case _GUARD_SHAPE_VERSION_1:
+            return 1;
+        case _GUARD_SHAPE_VERSION_2:
+            return 1;
+        case _LOAD_ATTR_POLYMORPHIC:
+            return 2;
         case _CHECK_ATTR_MODULE_PUSH_KEYS:
             return 0;
         case _LOAD_ATTR_MODULE_FROM_KEYS:
@@ -891,6 +959,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _COMPARE_OP_STR:
             return 2;
+        case _COMPARE_OP_INT_FLOAT:
+            return 2;
+        case _COMPARE_OP_BYTES:
+            return 2;
+        case _COMPARE_OP_TUPLE:
+            return 2;
         case _IS_OP:
             return 2;
         case _CONTAINS_OP:
@@ -899,6 +973,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _CONTAINS_OP_DICT:
             return 2;
+        case _CONTAINS_OP_TUPLE:
+            return 2;
         case _CHECK_EG_MATCH:
             return 2;
         case _CHECK_EXC_MATCH:
@@ -945,6 +1021,18 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _FOR_ITER_GEN_FRAME:
             return 0;
+        case _ITER_CHECK_DICT_ITEMS:
+            return 0;
+        case _ITER_CHECK_ENUMERATE:
+            return 0;
+        case _ITER_CHECK_ZIP:
+            return 0;
+        case _FOR_ITER_DICT_ITEMS_UNPACKED:
+            return 0;
+        case _FOR_ITER_ENUMERATE_UNPACKED:
+            return 0;
+        case _FOR_ITER_ZIP_UNPACKED:
+            return 0;
         case _LOAD_SPECIAL:
             return 1;
         case _WITH_EXCEPT_START:
@@ -1055,8 +1143,16 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _CALL_KW_NON_PY:
             return 3 + oparg;
+        case _CALL_KW_BUILTIN_FAST:
+            return 3 + oparg;
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST:
+            return 3 + oparg;
         case _MAKE_CALLARGS_A_TUPLE:
             return 1 + (oparg & 1);
+        case _CHECK_IS_NOT_PY_CALLABLE_EX:
+            return 0;
+        case _CALL_FUNCTION_EX_NON_PY:
+            return 3 + (oparg & 1);
         case _MAKE_FUNCTION:
             return 1;
         case _SET_FUNCTION_ATTRIBUTE:
@@ -1103,12 +1199,24 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _POP_TOP_LOAD_CONST_INLINE_BORROW:
             return 1;
+        case _ENTER_INLINED:
+            return 2 + oparg;
+        case _RETURN_INLINED:
+            return 2 + oparg;
+        case _ENTER_GUARDED_INLINED:
+            return 0;
+        case _RETURN_GUARDED_INLINED:
+            return 3 + oparg;
+        case _MATERIALIZE_INLINED_FRAME:
+            return 0;
         case _LOAD_CONST_INLINE_WITH_NULL:
             return 0;
         case _LOAD_CONST_INLINE_BORROW_WITH_NULL:
             return 0;
         case _CHECK_FUNCTION:
             return 0;
+        case _GUARD_LOCAL_TYPE_VERSION:
+            return 0;
         case _LOAD_GLOBAL_MODULE:
             return 0;
         case _LOAD_GLOBAL_BUILTINS:
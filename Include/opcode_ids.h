@@ -127,85 +127,101 @@ extern "C" {
 #define UNPACK_EX                              114
 #define UNPACK_SEQUENCE                        115
 #define YIELD_VALUE                            116
-#define RESUME                                 149
-#define BINARY_OP_ADD_FLOAT                    150
-#define BINARY_OP_ADD_INT                      151
-#define BINARY_OP_ADD_UNICODE                  152
-#define BINARY_OP_MULTIPLY_FLOAT               153
-#define BINARY_OP_MULTIPLY_INT                 154
-#define BINARY_OP_SUBTRACT_FLOAT               155
-#define BINARY_OP_SUBTRACT_INT                 156
-#define BINARY_SUBSCR_DICT                     157
-#define BINARY_SUBSCR_GETITEM                  158
-#define BINARY_SUBSCR_LIST_INT                 159
-#define BINARY_SUBSCR_STR_INT                  160
-#define BINARY_SUBSCR_TUPLE_INT                161
-#define CALL_ALLOC_AND_ENTER_INIT              162
-#define CALL_BOUND_METHOD_EXACT_ARGS           163
-#define CALL_BOUND_METHOD_GENERAL              164
-#define CALL_BUILTIN_CLASS                     165
-#define CALL_BUILTIN_FAST                      166
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS        167
-#define CALL_BUILTIN_O                         168
-#define CALL_ISINSTANCE                        169
-#define CALL_KW_BOUND_METHOD                   170
-#define CALL_KW_NON_PY                         171
-#define CALL_KW_PY                             172
-#define CALL_LEN                               173
-#define CALL_LIST_APPEND                       174
-#define CALL_METHOD_DESCRIPTOR_FAST            175
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 176
-#define CALL_METHOD_DESCRIPTOR_NOARGS          177
-#define CALL_METHOD_DESCRIPTOR_O               178
-#define CALL_NON_PY_GENERAL                    179
-#define CALL_PY_EXACT_ARGS                     180
-#define CALL_PY_GENERAL                        181
-#define CALL_STR_1                             182
-#define CALL_TUPLE_1                           183
-#define CALL_TYPE_1                            184
-#define COMPARE_OP_FLOAT                       185
-#define COMPARE_OP_INT                         186
-#define COMPARE_OP_STR                         187
-#define CONTAINS_OP_DICT                       188
-#define CONTAINS_OP_SET                        189
-#define FOR_ITER_GEN                           190
-#define FOR_ITER_LIST                          191
-#define FOR_ITER_RANGE                         192
-#define FOR_ITER_TUPLE                         193
-#define LOAD_ATTR_CLASS                        194
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   195
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      196
-#define LOAD_ATTR_INSTANCE_VALUE               197
-#define LOAD_ATTR_METHOD_LAZY_DICT             198
-#define LOAD_ATTR_METHOD_NO_DICT               199
-#define LOAD_ATTR_METHOD_WITH_VALUES           200
-#define LOAD_ATTR_MODULE                       201
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        202
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    203
-#define LOAD_ATTR_PROPERTY                     204
-#define LOAD_ATTR_SLOT                         205
-#define LOAD_ATTR_WITH_HINT                    206
-#define LOAD_CONST_IMMORTAL                    207
-#define LOAD_GLOBAL_BUILTIN                    208
-#define LOAD_GLOBAL_MODULE                     209
-#define LOAD_SUPER_ATTR_ATTR                   210
-#define LOAD_SUPER_ATTR_METHOD                 211
-#define RESUME_CHECK                           212
-#define SEND_GEN                               213
-#define STORE_ATTR_INSTANCE_VALUE              214
-#define STORE_ATTR_SLOT                        215
-#define STORE_ATTR_WITH_HINT                   216
-#define STORE_SUBSCR_DICT                      217
-#define STORE_SUBSCR_LIST_INT                  218
-#define TO_BOOL_ALWAYS_TRUE                    219
-#define TO_BOOL_BOOL                           220
-#define TO_BOOL_INT                            221
-#define TO_BOOL_LIST                           222
-#define TO_BOOL_NONE                           223
-#define TO_BOOL_STR                            224
-#define UNPACK_SEQUENCE_LIST                   225
-#define UNPACK_SEQUENCE_TUPLE                  226
-#define UNPACK_SEQUENCE_TWO_TUPLE              227
+#define RESUME                                 128
+#define BINARY_OP_ADD_FLOAT                    129
+#define BINARY_OP_ADD_INT                      130
+#define BINARY_OP_ADD_UNICODE                  131
+#define BINARY_OP_MULTIPLY_FLOAT               132
+#define BINARY_OP_MULTIPLY_INT                 133
+#define BINARY_OP_REMAINDER_UNICODE            134
+#define BINARY_OP_SUBTRACT_FLOAT               135
+#define BINARY_OP_SUBTRACT_INT                 136
+#define BINARY_SUBSCR_DICT                     137
+#define BINARY_SUBSCR_GETITEM                  138
+#define BINARY_SUBSCR_LIST_INT                 139
+#define BINARY_SUBSCR_STR_INT                  140
+#define BINARY_SUBSCR_TUPLE_INT                141
+#define CALL_ALLOC_AND_ENTER_INIT              142
+#define CALL_BOUND_METHOD_EXACT_ARGS           143
+#define CALL_BOUND_METHOD_GENERAL              144
+#define CALL_BUILTIN_CLASS                     145
+#define CALL_BUILTIN_FAST                      146
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS        147
+#define CALL_BUILTIN_O                         148
+#define CALL_FUNCTION_EX_NON_PY                149
+#define CALL_ISINSTANCE                        150
+#define CALL_KW_BOUND_METHOD                   151
+#define CALL_KW_BUILTIN_FAST                   152
+#define CALL_KW_METHOD_DESCRIPTOR_FAST         153
+#define CALL_KW_NON_PY                         154
+#define CALL_KW_PY                             155
+#define CALL_LEN                               156
+#define CALL_LIST_APPEND                       157
+#define CALL_METHOD_DESCRIPTOR_FAST            158
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 159
+#define CALL_METHOD_DESCRIPTOR_NOARGS          160
+#define CALL_METHOD_DESCRIPTOR_O               161
+#define CALL_NON_PY_GENERAL                    162
+#define CALL_PY_EXACT_ARGS                     163
+#define CALL_PY_GENERAL                        164
+#define CALL_STR_1                             165
+#define CALL_TUPLE_1                           166
+#define CALL_TYPE_1                            167
+#define COMPARE_OP_BYTES                       168
+#define COMPARE_OP_FLOAT                       169
+#define COMPARE_OP_INT                         170
+#define COMPARE_OP_INT_FLOAT                   171
+#define COMPARE_OP_STR                         172
+#define COMPARE_OP_TUPLE                       173
+#define CONTAINS_OP_DICT                       174
+#define CONTAINS_OP_SET                        175
+#define CONTAINS_OP_TUPLE                      176
+#define FOR_ITER_DICT_ITEMS                    177
+#define FOR_ITER_ENUMERATE                     178
+#define FOR_ITER_GEN                           179
+#define FOR_ITER_LIST                          180
+#define FOR_ITER_RANGE                         181
+#define FOR_ITER_TUPLE                         182
+#define FOR_ITER_ZIP                           183
+#define LOAD_ATTR_CLASS                        184
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   185
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      186
+#define LOAD_ATTR_INSTANCE_VALUE               187
+#define LOAD_ATTR_METHOD_LAZY_DICT             188
+#define LOAD_ATTR_METHOD_NO_DICT               189
+#define LOAD_ATTR_METHOD_WITH_VALUES           190
+#define LOAD_ATTR_MODULE                       191
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        192
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    193
+#define LOAD_ATTR_POLYMORPHIC                  194
+#define LOAD_ATTR_PROPERTY                     195
+#define LOAD_ATTR_SLOT                         196
+#define LOAD_ATTR_WITH_HINT                    197
+#define LOAD_CONST_IMMORTAL                    198
+#define LOAD_DEREF__LOAD_DEREF                 199
+#define LOAD_DEREF__LOAD_FAST                  200
+#define LOAD_FAST__LOAD_FAST                   201
+#define LOAD_FAST__RETURN_VALUE                202
+#define LOAD_GLOBAL_BUILTIN                    203
+#define LOAD_GLOBAL_MODULE                     204
+#define LOAD_SUPER_ATTR_ATTR                   205
+#define LOAD_SUPER_ATTR_METHOD                 206
+#define RESUME_CHECK                           207
+#define SEND_GEN                               208
+#define STORE_ATTR_INSTANCE_VALUE              209
+#define STORE_ATTR_SLOT                        210
+#define STORE_ATTR_WITH_HINT                   211
+#define STORE_SUBSCR_DICT                      212
+#define STORE_SUBSCR_LIST_INT                  213
+#define TO_BOOL_ALWAYS_TRUE                    214
+#define TO_BOOL_BOOL                           215
+#define TO_BOOL_INT                            216
+#define TO_BOOL_LIST                           217
+#define TO_BOOL_NONE                           218
+#define TO_BOOL_STR                            219
+#define UNPACK_SEQUENCE_LIST                   220
+#define UNPACK_SEQUENCE_TUPLE                  221
+#define UNPACK_SEQUENCE_TWO_TUPLE              222
 #define INSTRUMENTED_END_FOR                   236
 #define INSTRUMENTED_END_SEND                  237
 #define INSTRUMENTED_LOAD_SUPER_ATTR           238
@@ -238,7 +254,7 @@ extern "C" {
 #define STORE_FAST_MAYBE_NULL                  265
 
 #define HAVE_ARGUMENT                           42
-#define MIN_SPECIALIZED_OPCODE                 150
+#define MIN_SPECIALIZED_OPCODE                 129
 #define MIN_INSTRUMENTED_OPCODE                236
 
 #ifdef __cplusplus
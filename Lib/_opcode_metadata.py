@@ -25,6 +25,7 @@ _specializations = {
         "BINARY_OP_ADD_FLOAT",
         "BINARY_OP_SUBTRACT_FLOAT",
         "BINARY_OP_ADD_UNICODE",
+        "BINARY_OP_REMAINDER_UNICODE",
         "BINARY_OP_INPLACE_ADD_UNICODE",
     ],
     "BINARY_SUBSCR": [
@@ -73,21 +74,29 @@ _specializations = {
         "LOAD_ATTR_METHOD_LAZY_DICT",
         "LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES",
         "LOAD_ATTR_NONDESCRIPTOR_NO_DICT",
+        "LOAD_ATTR_POLYMORPHIC",
     ],
     "COMPARE_OP": [
         "COMPARE_OP_FLOAT",
         "COMPARE_OP_INT",
         "COMPARE_OP_STR",
+        "COMPARE_OP_INT_FLOAT",
+        "COMPARE_OP_BYTES",
+        "COMPARE_OP_TUPLE",
     ],
     "CONTAINS_OP": [
         "CONTAINS_OP_SET",
         "CONTAINS_OP_DICT",
+        "CONTAINS_OP_TUPLE",
     ],
     "FOR_ITER": [
         "FOR_ITER_LIST",
         "FOR_ITER_TUPLE",
         "FOR_ITER_RANGE",
         "FOR_ITER_GEN",
+        "FOR_ITER_DICT_ITEMS",
+        "FOR_ITER_ENUMERATE",
+        "FOR_ITER_ZIP",
     ],
     "CALL": [
         "CALL_BOUND_METHOD_EXACT_ARGS",
@@ -115,95 +124,124 @@ _specializations = {
         "CALL_KW_BOUND_METHOD",
         "CALL_KW_PY",
         "CALL_KW_NON_PY",
+        "CALL_KW_BUILTIN_FAST",
+        "CALL_KW_METHOD_DESCRIPTOR_FAST",
+    ],
+    "CALL_FUNCTION_EX": [
+        "CALL_FUNCTION_EX_NON_PY",
+    ],
+    "LOAD_FAST": [
+        "LOAD_FAST__LOAD_FAST",
+        "LOAD_FAST__RETURN_VALUE",
+    ],
+    "LOAD_DEREF": [
+        "LOAD_DEREF__LOAD_DEREF",
+        "LOAD_DEREF__LOAD_FAST",
     ],
 }
 
 _specialized_opmap = {
-    'BINARY_OP_ADD_FLOAT': 150,
-    'BINARY_OP_ADD_INT': 151,
-    'BINARY_OP_ADD_UNICODE': 152,
+    'BINARY_OP_ADD_FLOAT': 129,
+    'BINARY_OP_ADD_INT': 130,
+    'BINARY_OP_ADD_UNICODE': 131,
     'BINARY_OP_INPLACE_ADD_UNICODE': 3,
-    'BINARY_OP_MULTIPLY_FLOAT': 153,
-    'BINARY_OP_MULTIPLY_INT': 154,
-    'BINARY_OP_SUBTRACT_FLOAT': 155,
-    'BINARY_OP_SUBTRACT_INT': 156,
-    'BINARY_SUBSCR_DICT': 157,
-    'BINARY_SUBSCR_GETITEM': 158,
-    'BINARY_SUBSCR_LIST_INT': 159,
-    'BINARY_SUBSCR_STR_INT': 160,
-    'BINARY_SUBSCR_TUPLE_INT': 161,
-    'CALL_ALLOC_AND_ENTER_INIT': 162,
-    'CALL_BOUND_METHOD_EXACT_ARGS': 163,
-    'CALL_BOUND_METHOD_GENERAL': 164,
-    'CALL_BUILTIN_CLASS': 165,
-    'CALL_BUILTIN_FAST': 166,
-    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 167,
-    'CALL_BUILTIN_O': 168,
-    'CALL_ISINSTANCE': 169,
-    'CALL_KW_BOUND_METHOD': 170,
-    'CALL_KW_NON_PY': 171,
-    'CALL_KW_PY': 172,
-    'CALL_LEN': 173,
-    'CALL_LIST_APPEND': 174,
-    'CALL_METHOD_DESCRIPTOR_FAST': 175,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 176,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 177,
-    'CALL_METHOD_DESCRIPTOR_O': 178,
-    'CALL_NON_PY_GENERAL': 179,
-    'CALL_PY_EXACT_ARGS': 180,
-    'CALL_PY_GENERAL': 181,
-    'CALL_STR_1': 182,
-    'CALL_TUPLE_1': 183,
-    'CALL_TYPE_1': 184,
-    'COMPARE_OP_FLOAT': 185,
-    'COMPARE_OP_INT': 186,
-    'COMPARE_OP_STR': 187,
-    'CONTAINS_OP_DICT': 188,
-    'CONTAINS_OP_SET': 189,
-    'FOR_ITER_GEN': 190,
-    'FOR_ITER_LIST': 191,
-    'FOR_ITER_RANGE': 192,
-    'FOR_ITER_TUPLE': 193,
-    'LOAD_ATTR_CLASS': 194,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 195,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 196,
-    'LOAD_ATTR_INSTANCE_VALUE': 197,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 198,
-    'LOAD_ATTR_METHOD_NO_DICT': 199,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 200,
-    'LOAD_ATTR_MODULE': 201,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 202,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 203,
-    'LOAD_ATTR_PROPERTY': 204,
-    'LOAD_ATTR_SLOT': 205,
-    'LOAD_ATTR_WITH_HINT': 206,
-    'LOAD_CONST_IMMORTAL': 207,
-    'LOAD_GLOBAL_BUILTIN': 208,
-    'LOAD_GLOBAL_MODULE': 209,
-    'LOAD_SUPER_ATTR_ATTR': 210,
-    'LOAD_SUPER_ATTR_METHOD': 211,
-    'RESUME_CHECK': 212,
-    'SEND_GEN': 213,
-    'STORE_ATTR_INSTANCE_VALUE': 214,
-    'STORE_ATTR_SLOT': 215,
-    'STORE_ATTR_WITH_HINT': 216,
-    'STORE_SUBSCR_DICT': 217,
-    'STORE_SUBSCR_LIST_INT': 218,
-    'TO_BOOL_ALWAYS_TRUE': 219,
-    'TO_BOOL_BOOL': 220,
-    'TO_BOOL_INT': 221,
-    'TO_BOOL_LIST': 222,
-    'TO_BOOL_NONE': 223,
-    'TO_BOOL_STR': 224,
-    'UNPACK_SEQUENCE_LIST': 225,
-    'UNPACK_SEQUENCE_TUPLE': 226,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 227,
+    'BINARY_OP_MULTIPLY_FLOAT': 132,
+    'BINARY_OP_MULTIPLY_INT': 133,
+    'BINARY_OP_REMAINDER_UNICODE': 134,
+    'BINARY_OP_SUBTRACT_FLOAT': 135,
+    'BINARY_OP_SUBTRACT_INT': 136,
+    'BINARY_SUBSCR_DICT': 137,
+    'BINARY_SUBSCR_GETITEM': 138,
+    'BINARY_SUBSCR_LIST_INT': 139,
+    'BINARY_SUBSCR_STR_INT': 140,
+    'BINARY_SUBSCR_TUPLE_INT': 141,
+    'CALL_ALLOC_AND_ENTER_INIT': 142,
+    'CALL_BOUND_METHOD_EXACT_ARGS': 143,
+    'CALL_BOUND_METHOD_GENERAL': 144,
+    'CALL_BUILTIN_CLASS': 145,
+    'CALL_BUILTIN_FAST': 146,
+    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 147,
+    'CALL_BUILTIN_O': 148,
+    'CALL_FUNCTION_EX_NON_PY': 149,
+    'CALL_ISINSTANCE': 150,
+    'CALL_KW_BOUND_METHOD': 151,
+    'CALL_KW_BUILTIN_FAST': 152,
+    'CALL_KW_METHOD_DESCRIPTOR_FAST': 153,
+    'CALL_KW_NON_PY': 154,
+    'CALL_KW_PY': 155,
+    'CALL_LEN': 156,
+    'CALL_LIST_APPEND': 157,
+    'CALL_METHOD_DESCRIPTOR_FAST': 158,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 159,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 160,
+    'CALL_METHOD_DESCRIPTOR_O': 161,
+    'CALL_NON_PY_GENERAL': 162,
+    'CALL_PY_EXACT_ARGS': 163,
+    'CALL_PY_GENERAL': 164,
+    'CALL_STR_1': 165,
+    'CALL_TUPLE_1': 166,
+    'CALL_TYPE_1': 167,
+    'COMPARE_OP_BYTES': 168,
+    'COMPARE_OP_FLOAT': 169,
+    'COMPARE_OP_INT': 170,
+    'COMPARE_OP_INT_FLOAT': 171,
+    'COMPARE_OP_STR': 172,
+    'COMPARE_OP_TUPLE': 173,
+    'CONTAINS_OP_DICT': 174,
+    'CONTAINS_OP_SET': 175,
+    'CONTAINS_OP_TUPLE': 176,
+    'FOR_ITER_DICT_ITEMS': 177,
+    'FOR_ITER_ENUMERATE': 178,
+    'FOR_ITER_GEN': 179,
+    'FOR_ITER_LIST': 180,
+    'FOR_ITER_RANGE': 181,
+    'FOR_ITER_TUPLE': 182,
+    'FOR_ITER_ZIP': 183,
+    'LOAD_ATTR_CLASS': 184,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 185,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 186,
+    'LOAD_ATTR_INSTANCE_VALUE': 187,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 188,
+    'LOAD_ATTR_METHOD_NO_DICT': 189,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 190,
+    'LOAD_ATTR_MODULE': 191,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 192,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 193,
+    'LOAD_ATTR_POLYMORPHIC': 194,
+    'LOAD_ATTR_PROPERTY': 195,
+    'LOAD_ATTR_SLOT': 196,
+    'LOAD_ATTR_WITH_HINT': 197,
+    'LOAD_CONST_IMMORTAL': 198,
+    'LOAD_DEREF__LOAD_DEREF': 199,
+    'LOAD_DEREF__LOAD_FAST': 200,
+    'LOAD_FAST__LOAD_FAST': 201,
+    'LOAD_FAST__RETURN_VALUE': 202,
+    'LOAD_GLOBAL_BUILTIN': 203,
+    'LOAD_GLOBAL_MODULE': 204,
+    'LOAD_SUPER_ATTR_ATTR': 205,
+    'LOAD_SUPER_ATTR_METHOD': 206,
+    'RESUME_CHECK': 207,
+    'SEND_GEN': 208,
+    'STORE_ATTR_INSTANCE_VALUE': 209,
+    'STORE_ATTR_SLOT': 210,
+    'STORE_ATTR_WITH_HINT': 211,
+    'STORE_SUBSCR_DICT': 212,
+    'STORE_SUBSCR_LIST_INT': 213,
+    'TO_BOOL_ALWAYS_TRUE': 214,
+    'TO_BOOL_BOOL': 215,
+    'TO_BOOL_INT': 216,
+    'TO_BOOL_LIST': 217,
+    'TO_BOOL_NONE': 218,
+    'TO_BOOL_STR': 219,
+    'UNPACK_SEQUENCE_LIST': 220,
+    'UNPACK_SEQUENCE_TUPLE': 221,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 222,
 }
 
 opmap = {
     'CACHE': 0,
     'RESERVED': 17,
-    'RESUME': 149,
+    'RESUME': 128,
     'INSTRUMENTED_LINE': 254,
     'ENTER_EXECUTOR': 255,
     'BINARY_SLICE': 1,
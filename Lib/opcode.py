@@ -89,6 +89,9 @@
         "counter": 1,
         "func_version": 2,
     },
+    "CALL_FUNCTION_EX": {
+        "counter": 1,
+    },
     "STORE_SUBSCR": {
         "counter": 1,
     },
@@ -4,6 +4,7 @@
 import unittest
 import gc
 import os
+import sysconfig
 
 import _opcode
 
@@ -14,6 +15,10 @@
 
 from _testinternalcapi import TIER2_THRESHOLD
 
+requires_jit = unittest.skipUnless(
+    "-D_Py_JIT" in (sysconfig.get_config_var("PY_CFLAGS_NODIST") or ""),
+    "requires the JIT")
+
 @contextlib.contextmanager
 def temporary_optimizer(opt):
     old_opt = _testinternalcapi.get_optimizer()
@@ -77,6 +82,100 @@ def loop():
                     loop()
                 self.assertEqual(opt.get_count(), 1001)
 
+    def test_threshold_env_var(self):
+        code = textwrap.dedent("""
+            import _testinternalcapi
+            assert _testinternalcapi.TIER2_THRESHOLD == 16
+
+            def loop():
+                for _ in range(16 + 100):
+                    pass
+
+            opt = _testinternalcapi.new_counter_optimizer()
+            _testinternalcapi.set_optimizer(opt)
+            loop()
+            assert opt.get_count() == 101, opt.get_count()
+        """)
+        script_helper.assert_python_ok("-c", code, PYTHON_JIT_THRESHOLD="16")
+        for value in ("0", "4097", "-1", "ten"):
+            with self.subTest(value=value):
+                _, _, err = script_helper.assert_python_failure(
+                    "-c", "pass", PYTHON_JIT_THRESHOLD=value)
+                self.assertIn(b"PYTHON_JIT_THRESHOLD must be", err)
+
+    def test_background_compilation(self):
+        code = textwrap.dedent("""
+            import _opcode, time
+            from test.support import SHORT_TIMEOUT
+
+            def get_first_executor(func):
+                code = func.__code__
+                for i in range(0, len(code.co_code), 2):
+                    try:
+                        return _opcode.get_executor(code, i)
+                    except ValueError:
+                        pass
+                return None
+
+            def loop():
+                total = 0
+                for i in range(100):
+                    total += i
+                return total
+
+            # The first time the loop gets hot, its executor is handed to
+            # the worker thread. It is installed on a later attempt.
+            deadline = time.monotonic() + SHORT_TIMEOUT
+            while (ex := get_first_executor(loop)) is None:
+                assert time.monotonic() < deadline, "executor never installed"
+                assert loop() == 4950
+            assert ex.is_valid()
+            assert loop() == 4950
+        """)
+        script_helper.assert_python_ok("-c", code, PYTHON_JIT="1",
+                                       PYTHON_JIT_BACKGROUND="1",
+                                       PYTHON_JIT_THRESHOLD="16")
+
+    @requires_jit
+    def test_jit_arena(self):
+        code = textwrap.dedent("""
+            import _opcode, sys
+
+            def get_first_executor(func):
+                code = func.__code__
+                for i in range(0, len(code.co_code), 2):
+                    try:
+                        return _opcode.get_executor(code, i)
+                    except ValueError:
+                        pass
+                return None
+
+            funcs = []
+            for n in range(50):
+                ns = {}
+                exec(f"def f():\\n"
+                     f"    total = 0\\n"
+                     f"    for i in range(100):\\n"
+                     f"        total += i + {n}\\n"
+                     f"    return total\\n", ns)
+                funcs.append(ns["f"])
+
+            # Compile, run and free the executors twice, so that the second
+            # round also allocates from the memory the first one released.
+            for _ in range(2):
+                for n, f in enumerate(funcs):
+                    assert f() == 4950 + 100 * n
+                executors = [get_first_executor(f) for f in funcs]
+                assert all(ex is not None for ex in executors)
+                assert all(ex.get_jit_code() for ex in executors)
+                for n, f in enumerate(funcs):
+                    assert f() == 4950 + 100 * n
+                sys._clear_internal_caches()
+                assert not any(ex.is_valid() for ex in executors)
+        """)
+        script_helper.assert_python_ok(
+            "-c", code, PYTHON_JIT="1", PYTHON_JIT_THRESHOLD="16")
+
     def test_long_loop(self):
         "Check that we aren't confused by EXTENDED_ARG"
 
@@ -219,6 +318,49 @@ def f():
         exe = get_first_executor(f)
         self.assertIsNone(exe)
 
+    def test_monitoring_invalidates_linked_executors(self):
+        def f(flags):
+            # Two back edges: "continue" and the end of the loop body.
+            for flag in flags:
+                if flag:
+                    continue
+                pass
+
+        def get_executors(func):
+            code = func.__code__
+            executors = []
+            for i in range(0, len(code.co_code), 2):
+                try:
+                    executors.append(_opcode.get_executor(code, i))
+                except ValueError:
+                    pass
+            return executors
+
+        def clear_tool():
+            sys.monitoring.use_tool_id(sys.monitoring.DEBUGGER_ID, "test")
+            sys.monitoring.clear_tool_id(sys.monitoring.DEBUGGER_ID)
+            sys.monitoring.free_tool_id(sys.monitoring.DEBUGGER_ID)
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        for reset in (clear_tool, sys.monitoring.restart_events):
+            with (self.subTest(reset=reset.__name__),
+                  temporary_optimizer(opt), clear_executors(f)):
+                f([True] * TIER2_THRESHOLD)
+                f([False] * TIER2_THRESHOLD)
+                executors = get_executors(f)
+                self.assertEqual(len(executors), 2)
+                # Enter at "continue" and leave the trace through the exit
+                # to the other back edge, which links to its executor.
+                f([True, False])
+                links = [(a, b) for a in executors for b in executors
+                         if b in gc.get_referents(a)]
+                self.assertEqual(len(links), 1)
+                for exe in executors:
+                    self.assertTrue(exe.is_valid())
+                reset()
+                for exe in executors:
+                    self.assertFalse(exe.is_valid())
+
 
 @requires_specialization
 @unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
@@ -585,6 +727,29 @@ def testfunc(n):
         count = ops.count("_GUARD_IS_TRUE_POP") + ops.count("_GUARD_IS_FALSE_POP")
         self.assertLessEqual(count, 2)
 
+    def test_executor_stats(self):
+        def testfunc(n):
+            total = 0
+            for i in range(n):
+                total += i
+            return total
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            testfunc(TIER2_THRESHOLD + 10)
+            for _ in range(3):
+                testfunc(10)
+        self.assertIsNotNone(get_first_executor(testfunc))
+        [stats] = [stats for stats in sys._get_executor_stats()
+                   if stats["code"] is testfunc.__code__]
+        # The line of the loop's back edge
+        self.assertEqual(stats["line"], testfunc.__code__.co_firstlineno + 3)
+        self.assertEqual(stats["entries"], 4)
+        self.assertEqual(stats["deopts"], 0)
+        # Every call leaves the trace through the exit for the exhausted range
+        self.assertEqual(sorted(stats["exits"])[-1], 4)
+        self.assertEqual(sum(stats["exits"]), 4)
+
 
 @requires_specialization
 @unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
@@ -1137,7 +1302,8 @@ def testfunc(n):
 
     def test_combine_stack_space_complex(self):
         def dummy0(x):
-            return x
+            # Not trivial enough to be inlined
+            return x + 0
         def dummy1(x):
             return dummy0(x)
         def dummy2(x):
@@ -1356,7 +1522,7 @@ class Foo:
         opnames = list(iter_opnames(ex))
         self.assertIsNotNone(ex)
         self.assertEqual(res, TIER2_THRESHOLD * 2)
-        guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
+        guard_type_version_count = opnames.count("_GUARD_LOCAL_TYPE_VERSION")
         self.assertEqual(guard_type_version_count, 1)
 
     def test_guard_type_version_removed_inlined(self):
@@ -1382,7 +1548,7 @@ class Foo:
         opnames = list(iter_opnames(ex))
         self.assertIsNotNone(ex)
         self.assertEqual(res, TIER2_THRESHOLD * 2)
-        guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
+        guard_type_version_count = opnames.count("_GUARD_LOCAL_TYPE_VERSION")
         self.assertEqual(guard_type_version_count, 1)
 
     def test_guard_type_version_removed_invalidation(self):
@@ -1412,7 +1578,7 @@ class Bar:
         call = opnames.index("_CALL_BUILTIN_FAST")
         load_attr_top = opnames.index("_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES", 0, call)
         load_attr_bottom = opnames.index("_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES", call)
-        self.assertEqual(opnames[:load_attr_top].count("_GUARD_TYPE_VERSION"), 1)
+        self.assertEqual(opnames[:load_attr_top].count("_GUARD_LOCAL_TYPE_VERSION"), 1)
         self.assertEqual(opnames[call:load_attr_bottom].count("_CHECK_VALIDITY"), 1)
 
     def test_guard_type_version_removed_escaping(self):
@@ -1435,7 +1601,7 @@ class Foo:
         call = opnames.index("_CALL_BUILTIN_FAST_WITH_KEYWORDS")
         load_attr_top = opnames.index("_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES", 0, call)
         load_attr_bottom = opnames.index("_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES", call)
-        self.assertEqual(opnames[:load_attr_top].count("_GUARD_TYPE_VERSION"), 1)
+        self.assertEqual(opnames[:load_attr_top].count("_GUARD_LOCAL_TYPE_VERSION"), 1)
         self.assertEqual(opnames[call:load_attr_bottom].count("_CHECK_VALIDITY"), 1)
 
     def test_guard_type_version_executor_invalidated(self):
@@ -1456,11 +1622,74 @@ class Foo:
         res, ex = self._run_with_optimizer(thing, Foo())
         self.assertEqual(res, TIER2_THRESHOLD * 2)
         self.assertIsNotNone(ex)
-        self.assertEqual(list(iter_opnames(ex)).count("_GUARD_TYPE_VERSION"), 1)
+        self.assertEqual(list(iter_opnames(ex)).count("_GUARD_LOCAL_TYPE_VERSION"), 1)
         self.assertTrue(ex.is_valid())
         Foo.attr = 0
         self.assertFalse(ex.is_valid())
 
+    def test_guards_hoisted_out_of_loop(self):
+        def thing(a):
+            x = 0
+            for _ in range(TIER2_THRESHOLD):
+                x += a.attr + len(())
+            return x
+
+        class Foo:
+            attr = 1
+
+        res, ex = self._run_with_optimizer(thing, Foo())
+        self.assertEqual(res, TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        opnames = list(iter_opnames(ex))
+        loop_head = opnames.index("_MAKE_WARM")
+        self.assertIn("_GUARD_LOCAL_TYPE_VERSION", opnames[:loop_head])
+        self.assertIn("_CHECK_FUNCTION", opnames[:loop_head])
+        self.assertNotIn("_GUARD_TYPE_VERSION", opnames)
+        self.assertNotIn("_CHECK_FUNCTION", opnames[loop_head:])
+
+    def test_guard_type_version_not_hoisted_for_stored_local(self):
+        def thing(a):
+            x = 0
+            for _ in range(TIER2_THRESHOLD):
+                x += a.attr
+                a = a.other
+            return x
+
+        class Foo:
+            attr = 1
+        Foo.other = Foo()
+
+        res, ex = self._run_with_optimizer(thing, Foo())
+        self.assertEqual(res, TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        opnames = list(iter_opnames(ex))
+        self.assertNotIn("_GUARD_LOCAL_TYPE_VERSION", opnames)
+        self.assertIn("_GUARD_TYPE_VERSION", opnames)
+
+    def test_hoisted_guard_class_assignment(self):
+        def thing(a):
+            x = 0
+            dummy = Foo()
+            for i in range(TIER2_THRESHOLD * 2):
+                x += a.get()
+                # Change the class of a without leaving the trace
+                setattr((dummy, a)[i == TIER2_THRESHOLD], "__class__", Bar)
+            return x
+
+        # Nothing but the type version guards the method lookup
+        class Foo:
+            __slots__ = ()
+            def get(self):
+                return 1
+
+        class Bar:
+            __slots__ = ()
+            def get(self):
+                return 2
+
+        res, ex = self._run_with_optimizer(thing, Foo())
+        self.assertEqual(res, TIER2_THRESHOLD * 3 - 1)
+
     def test_type_version_doesnt_segfault(self):
         """
         Tests that setting a type version doesn't cause a segfault when later looking at the stack.
@@ -1495,13 +1724,330 @@ def testfunc(n):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
-        self.assertIn("_PUSH_FRAME", uops)
+        # global_identity() is simple enough to be inlined
+        self.assertIn("_ENTER_INLINED", uops)
         # Strength reduced version
         self.assertIn("_CHECK_FUNCTION_VERSION_INLINE", uops)
         self.assertNotIn("_CHECK_FUNCTION_VERSION", uops)
         # Removed guard
         self.assertNotIn("_CHECK_FUNCTION_EXACT_ARGS", uops)
 
+    def test_inline_trivial_calls(self):
+        class A:
+            def get_self(self):
+                return self
+        def second(x, y):
+            return y
+        def none(x):
+            return None
+        def not_trivial(x):
+            return x + 1
+        def testfunc(n):
+            a = A()
+            total = 0
+            for i in range(n):
+                total += second(None, i)
+                if none(i) is not None:
+                    break
+                if a.get_self() is not a:
+                    break
+                total += not_trivial(i)
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, sum(range(TIER2_THRESHOLD)) * 2 + TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertEqual(uops.count("_ENTER_INLINED"), 3)
+        self.assertEqual(uops.count("_RETURN_INLINED"), 3)
+        # not_trivial() can fail, so it needs a real frame
+        self.assertEqual(uops.count("_PUSH_FRAME"), 1)
+        self.assertEqual(uops.count("_RETURN_VALUE"), 1)
+        # Inlined callees keep their resume check, in front of the body
+        self.assertEqual(uops.count("_RESUME_CHECK"), 4)
+        for i, uop in enumerate(uops):
+            if uop == "_ENTER_INLINED":
+                self.assertEqual(uops[i - 1], "_RESUME_CHECK")
+
+    def test_inlined_callee_instrumentation(self):
+        def callee(x):
+            return x
+        def testfunc(n):
+            for i in range(n):
+                callee(i)
+
+        _, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        self.assertIn("_ENTER_INLINED", get_opnames(ex))
+        starts = []
+        tool = sys.monitoring.DEBUGGER_ID
+        sys.monitoring.use_tool_id(tool, "test")
+        try:
+            sys.monitoring.register_callback(
+                tool, sys.monitoring.events.PY_START,
+                lambda code, offset: starts.append(code))
+            sys.monitoring.set_local_events(
+                tool, callee.__code__, sys.monitoring.events.PY_START)
+            self.assertFalse(ex.is_valid())
+            testfunc(10)
+        finally:
+            sys.monitoring.set_local_events(tool, callee.__code__, 0)
+            sys.monitoring.free_tool_id(tool)
+        self.assertEqual(starts, [callee.__code__] * 10)
+
+    def test_inline_accessor_deopt(self):
+        class A:
+            x = 10
+            def __init__(self):
+                self.x = 1
+            def get(self):
+                return self.x
+        def testfunc(objs):
+            total = 0
+            for a in objs:
+                x = a.get()
+                total += x + 1
+            return total
+
+        res, ex = self._run_with_optimizer(
+            testfunc, [A() for _ in range(TIER2_THRESHOLD)])
+        self.assertEqual(res, TIER2_THRESHOLD * 2)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_ENTER_GUARDED_INLINED", uops)
+        self.assertIn("_RETURN_GUARDED_INLINED", uops)
+        self.assertIn("_LOAD_ATTR_INSTANCE_VALUE_0", uops)
+        self.assertIn("_MATERIALIZE_INLINED_FRAME", uops)
+        self.assertNotIn("_PUSH_FRAME", uops)
+        self.assertNotIn("_RETURN_VALUE", uops)
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            # The last call deopts in the inlined body of get(), which then
+            # finds the class attribute in a frame of its own
+            objs = [A() for _ in range(TIER2_THRESHOLD)]
+            del objs[-1].x
+            self.assertEqual(testfunc(objs), TIER2_THRESHOLD * 2 + 9)
+            self.assertTrue(ex.is_valid())
+
+            # The frame made on deopt shows up in the traceback
+            del A.x
+            try:
+                testfunc(objs)
+            except AttributeError as e:
+                tb = e.__traceback__
+            else:
+                self.fail("AttributeError not raised")
+        caller = tb.tb_next
+        self.assertIs(caller.tb_frame.f_code, testfunc.__code__)
+        self.assertEqual(caller.tb_lineno, testfunc.__code__.co_firstlineno + 3)
+        callee = caller.tb_next
+        self.assertIs(callee.tb_frame.f_code, A.get.__code__)
+        self.assertEqual(callee.tb_lineno, A.get.__code__.co_firstlineno + 1)
+        self.assertIs(callee.tb_frame.f_back, caller.tb_frame)
+        self.assertIsNone(callee.tb_next)
+
+    def test_build_and_unpack_tuple_removed(self):
+        def testfunc(n):
+            x = 0
+            for i in range(n):
+                a, b = (i, 1) if i >= 0 else (1, i)
+                (c,) = (b,) if i >= 0 else (a,)
+                d, e, f = (a, b, c) if i >= 0 else (c, b, a)
+                x += a - c + d - f
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, (sum(range(TIER2_THRESHOLD)) - TIER2_THRESHOLD) * 2)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BUILD_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TWO_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
+        self.assertEqual(uops.count("_SWAP"), 2)
+
+    def test_pair_iterators_unpack_without_tuple(self):
+        def dict_items(n):
+            x = 0
+            for k, v in dict.fromkeys(range(n), 1).items():
+                x += k + v
+            return x
+
+        def enumerate_list(n):
+            x = 0
+            for i, y in enumerate([1] * n):
+                x += i + y
+            return x
+
+        def zip_ranges(n):
+            x = 0
+            for a, b in zip(range(n), [1] * n):
+                x += a + b
+            return x
+
+        expected = sum(range(TIER2_THRESHOLD)) + TIER2_THRESHOLD
+        for testfunc, uop in [
+            (dict_items, "_FOR_ITER_DICT_ITEMS_UNPACKED"),
+            (enumerate_list, "_FOR_ITER_ENUMERATE_UNPACKED"),
+            (zip_ranges, "_FOR_ITER_ZIP_UNPACKED"),
+        ]:
+            with self.subTest(uop):
+                res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+                self.assertEqual(res, expected)
+                self.assertIsNotNone(ex)
+                uops = get_opnames(ex)
+                self.assertIn(uop, uops)
+                self.assertNotIn("_FOR_ITER_TIER_TWO", uops)
+                self.assertNotIn("_UNPACK_SEQUENCE_TWO_TUPLE", uops)
+
+    def test_pair_iterators_unpack_errors(self):
+        def grow_dict(n):
+            d = dict.fromkeys(range(n))
+            for k, v in d.items():
+                if k == n - 1:
+                    d[n] = None
+
+        def raise_in_enumerate(n):
+            def gen():
+                yield from range(n)
+                raise ValueError
+            for i, y in enumerate(gen()):
+                pass
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            with self.assertRaises(RuntimeError):
+                grow_dict(TIER2_THRESHOLD * 2)
+            with self.assertRaises(ValueError):
+                raise_in_enumerate(TIER2_THRESHOLD * 2)
+
+    def test_call_function_ex_builtin_in_trace(self):
+        def testfunc(n):
+            x = 0
+            args = (1, 2)
+            kwargs = {"default": 0}
+            for i in range(n):
+                x += max(*args) + max(args, **kwargs)
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * 4)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertEqual(uops.count("_CALL_FUNCTION_EX_NON_PY"), 2)
+
+    def test_load_attr_polymorphic(self):
+        class A:
+            def __init__(self, x):
+                self.x = x
+
+        class B:
+            __slots__ = ("x",)
+            def __init__(self, x):
+                self.x = x
+
+        class C:
+            __slots__ = ("y", "x")
+            def __init__(self, x):
+                self.y = None
+                self.x = x
+
+        def testfunc(objs):
+            total = 0
+            for obj in objs:
+                total += obj.x
+            return total
+
+        objs = [A(1), B(2), C(4)] * TIER2_THRESHOLD
+        testfunc(objs)
+        res, ex = self._run_with_optimizer(testfunc, objs)
+        self.assertEqual(res, 7 * TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_LOAD_ATTR_POLYMORPHIC", uops)
+        self.assertNotIn("_LOAD_ATTR", uops)
+
+    def test_fstring_formats_pieces_in_build_string(self):
+        class Fmt:
+            def __format__(self, spec):
+                return "fmt"
+
+        def testfunc(n):
+            x = 0.5
+            s = "s"
+            obj = Fmt()
+            res = []
+            for i in range(n):
+                res.append(f"{i}:{x}/{s}-{obj}{True}")
+            return res
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, [f"{i}:0.5/s-fmtTrue"
+                               for i in range(TIER2_THRESHOLD)])
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BUILD_STRING_FORMAT", uops)
+        self.assertNotIn("_FORMAT_SIMPLE", uops)
+        self.assertNotIn("_BUILD_STRING", uops)
+
+    def test_fstring_keeps_formatted_str_subclass(self):
+        # Only the pieces whose FORMAT_SIMPLE was fused are formatted by
+        # _BUILD_STRING_FORMAT. Here the walk back from the BUILD_STRING stops
+        # at the attribute load, so the str subclass returned for {a} is
+        # already formatted and must not be formatted again.
+        calls = 0
+
+        class S(str):
+            def __format__(self, spec):
+                nonlocal calls
+                calls += 1
+                return "twice"
+
+        class A:
+            def __format__(self, spec):
+                return S("a")
+
+        class O:
+            b = "b"
+
+        def testfunc(n):
+            a = A()
+            o = O()
+            res = []
+            for i in range(n):
+                res.append(f"{a}{o.b}{i}")
+            return res
+
+        n = TIER2_THRESHOLD * 2
+        res, ex = self._run_with_optimizer(testfunc, n)
+        self.assertEqual(res, [f"ab{i}" for i in range(n)])
+        self.assertEqual(calls, 0)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BUILD_STRING_FORMAT", uops)
+        self.assertIn("_FORMAT_SIMPLE", uops)
+
+    def test_fstring_format_errors(self):
+        class Bad:
+            def __init__(self, fail):
+                self.fail = fail
+            def __format__(self, spec):
+                if self.fail:
+                    raise ValueError
+                return "ok"
+
+        def testfunc(n, fail_at):
+            for i in range(n):
+                s = f"{i}{Bad(i == fail_at)}{-i}"
+            return s
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            n = TIER2_THRESHOLD
+            self.assertEqual(testfunc(n, -1), f"{n - 1}ok{1 - n}")
+            with self.assertRaises(ValueError):
+                testfunc(n * 2, n * 2 - 1)
+
     def test_jit_error_pops(self):
         """
         Tests that the correct number of pops are inserted into the
@@ -965,6 +965,31 @@ class Bar: pass
         self.assertIsInstance(f, Bar)
         self.assertEqual(f.__dict__, {})
 
+    def test_delete_attr_str_subclass_name(self):
+        class StrSubclass(str): pass
+        class C: pass
+        c = C()
+        c.a = 1
+        c.b = 2
+        self.assertTrue(has_inline_values(c))
+        delattr(c, StrSubclass("a"))
+        self.assertFalse(hasattr(c, "a"))
+        self.assertEqual(c.b, 2)
+        with self.assertRaises(AttributeError) as cm:
+            delattr(c, StrSubclass("a"))
+        self.assertEqual(cm.exception.name, "a")
+        self.assertIs(cm.exception.obj, c)
+
+    def test_delete_missing_attr(self):
+        class C: pass
+        c = C()
+        self.set_100(c)
+        for obj in (C(), c):
+            with self.assertRaises(AttributeError) as cm:
+                del obj.missing
+            self.assertEqual(cm.exception.name, "missing")
+            self.assertIs(cm.exception.obj, obj)
+
     def test_store_attr_type_cache(self):
         """Verifies that the type cache doesn't provide a value which  is
         inconsistent from the dict."""
@@ -362,6 +362,81 @@ class A:
             d2 = d.copy()
             self.assertEqual(gc.is_tracked(d), gc.is_tracked(d2))
 
+    @support.cpython_only
+    def test_track_literals(self):
+        # Dicts of atomic objects are not tracked by the GC until a key or
+        # value that may be tracked is inserted.
+        x, y, z, w = 1.5, "a", tuple([1, "b"]), []
+        self.assertFalse(gc.is_tracked({}))
+        self.assertFalse(gc.is_tracked({x: None, y: z, z: x}))
+        self.assertFalse(gc.is_tracked({x: frozenset([y])}))
+
+        self.assertTrue(gc.is_tracked({x: w}))
+        self.assertTrue(gc.is_tracked({x: {}}))
+        self.assertTrue(gc.is_tracked({x: (y, w)}))
+
+    @support.cpython_only
+    def test_track_dynamic(self):
+        class A:
+            pass
+        x, w = 1.5, []
+
+        d = {}
+        d[1] = x
+        d["a"] = None
+        self.assertFalse(gc.is_tracked(d))
+        d["w"] = w
+        self.assertTrue(gc.is_tracked(d))
+        del d["w"]
+        self.assertTrue(gc.is_tracked(d))
+
+        self.assertFalse(gc.is_tracked(dict(a=1, b=x)))
+        self.assertFalse(gc.is_tracked(dict.fromkeys("ab", x)))
+        self.assertFalse(gc.is_tracked(dict(zip("ab", [1, 2]))))
+        self.assertTrue(gc.is_tracked(dict(a=w)))
+        self.assertTrue(gc.is_tracked(dict.fromkeys("ab", w)))
+
+        d = {1: x}
+        d.setdefault(2, x)
+        self.assertFalse(gc.is_tracked(d))
+        d.setdefault(3, A())
+        self.assertTrue(gc.is_tracked(d))
+
+        d = {1: x}
+        d.update({2: x})
+        self.assertFalse(gc.is_tracked(d))
+        d |= {3: w}
+        self.assertTrue(gc.is_tracked(d))
+
+    @support.cpython_only
+    def test_track_instance_dict(self):
+        # Stores through specialized attribute access must track the dict
+        class C:
+            pass
+        def store(obj, value):
+            obj.attr = value
+        c = C()
+        c.__dict__ = {"attr": None}
+        self.assertFalse(gc.is_tracked(c.__dict__))
+        for _ in range(100):
+            store(c, 1)
+        self.assertFalse(gc.is_tracked(c.__dict__))
+        store(c, c)
+        self.assertTrue(gc.is_tracked(c.__dict__))
+
+        ref = weakref.ref(c)
+        del c
+        gc.collect()
+        self.assertIsNone(ref())
+
+    @support.cpython_only
+    def test_track_subtypes(self):
+        # Dict subtypes are always tracked
+        class MyDict(dict):
+            pass
+        self.assertTrue(gc.is_tracked(MyDict()))
+        self.assertTrue(gc.is_tracked(MyDict(a=1)))
+
     def test_copy_noncompact(self):
         # Dicts don't compact themselves on del/pop operations.
         # Copy will use a slow merging strategy that produces
@@ -784,6 +859,33 @@ class G(dict):
             g[42]
         self.assertEqual(c.exception.args, (42,))
 
+    def test_missing_as_namespace(self):
+        # Name lookups in a dict subclass namespace don't go through
+        # dict.__getitem__(), but must still honour __missing__.
+        class D(dict):
+            def __missing__(self, key):
+                return key.upper()
+        self.assertEqual(eval("x", {}, D(y=1)), "X")
+        self.assertEqual(eval("y", {}, D(y=1)), 1)
+
+        class E(dict):
+            def __missing__(self, key):
+                raise RuntimeError(key)
+        with self.assertRaises(RuntimeError):
+            eval("x", {}, E())
+
+        class K(dict):
+            def __missing__(self, key):
+                raise KeyError(key)
+        with self.assertRaises(NameError):
+            eval("x", {}, K())
+
+        class G(dict):
+            pass
+        self.assertEqual(eval("len", {}, G()), len)
+        with self.assertRaises(NameError):
+            eval("undefined_name", {}, G())
+
     def test_tuple_keyerror(self):
         # SF #1576657
         d = {}
@@ -1,11 +1,13 @@
 import unittest
 
+import textwrap
 import threading
 from threading import Thread
 from unittest import TestCase
 import gc
 
 from test.support import threading_helper
+from test.support.script_helper import assert_python_ok
 
 
 class MyObj:
@@ -56,6 +58,52 @@ def mutator_thread():
         with threading_helper.start_threads(gcs + mutators):
             pass
 
+    def test_parallel_marking(self):
+        # The heap needs to be big enough for the collector to use more
+        # than one thread.
+        code = textwrap.dedent("""
+            import gc
+            import weakref
+
+            class Node:
+                def __init__(self):
+                    self.refs = []
+
+            class Finalizer:
+                def __del__(self):
+                    finalized.append(1)
+
+            finalized = []
+            gc.disable()
+
+            # A long chain is reachable from a single object
+            root = cur = Node()
+            for i in range(200_000):
+                cur.refs.append(Node())
+                cur = cur.refs[0]
+
+            garbage = []
+            for i in range(50_000):
+                a = Node()
+                b = Node()
+                a.refs += [b, Finalizer()]
+                b.refs.append(a)
+                garbage.append(weakref.ref(b))
+            del a, b
+
+            gc.collect()
+            assert len(finalized) == 50_000, len(finalized)
+            assert all(r() is None for r in garbage)
+
+            length = 0
+            cur = root
+            while cur.refs:
+                cur = cur.refs[0]
+                length += 1
+            assert length == 200_000, length
+        """)
+        assert_python_ok("-c", code, PYTHON_GC_THREADS="4")
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -811,12 +811,124 @@ def test_get_stats(self):
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
 
+    def test_get_type_stats(self):
+        class A:
+            pass
+
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        self.addCleanup(gc.set_debug, gc.get_debug())
+        self.addCleanup(gc.get_type_stats, reset=True)
+        gc.set_debug(gc.get_debug() | gc.DEBUG_TYPE_STATS)
+        gc.collect()
+        gc.get_type_stats(reset=True)
+
+        live = []
+        for i in range(10):
+            a = A()
+            a.self = a
+            live.append(a)
+        for i in range(100):
+            a = A()
+            a.self = a
+        del a
+        gc.collect()
+        stats = gc.get_type_stats()
+        self.assertEqual(set(stats[A]), {"traversed", "survived", "collected"})
+        self.assertEqual(stats[A]["collected"], 100)
+        self.assertEqual(stats[A]["survived"], 10)
+        self.assertGreaterEqual(stats[A]["traversed"], 110)
+        self.assertGreater(stats[list]["survived"], 0)
+
+        # The snapshot is not affected by later collections
+        gc.collect()
+        self.assertEqual(stats[A]["survived"], 10)
+        self.assertEqual(gc.get_type_stats(reset=True)[A]["survived"], 20)
+        self.assertNotIn(A, gc.get_type_stats())
+
+        # Nothing is recorded without the debug flag
+        gc.set_debug(gc.get_debug() & ~gc.DEBUG_TYPE_STATS)
+        gc.collect()
+        self.assertEqual(gc.get_type_stats(), {})
+
+    def test_get_type_stats_dead_type(self):
+        class TypeStatsDeadType:
+            pass
+
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        self.addCleanup(gc.set_debug, gc.get_debug())
+        self.addCleanup(gc.get_type_stats, reset=True)
+        gc.set_debug(gc.get_debug() | gc.DEBUG_TYPE_STATS)
+        gc.get_type_stats(reset=True)
+
+        for i in range(10):
+            a = TypeStatsDeadType()
+            a.self = a
+        del a
+        gc.collect()
+        self.assertEqual(gc.get_type_stats()[TypeStatsDeadType]["collected"],
+                         10)
+
+        # The statistics don't keep the type alive, and go away with it
+        wr = weakref.ref(TypeStatsDeadType)
+        del TypeStatsDeadType
+        gc.collect()
+        self.assertIsNone(wr())
+        names = {tp.__name__ for tp in gc.get_type_stats()}
+        self.assertNotIn("TypeStatsDeadType", names)
+
     def test_freeze(self):
         gc.freeze()
         self.assertGreater(gc.get_freeze_count(), 0)
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_immortalize(self):
+        # Run in a subprocess: the objects of the test runner would
+        # never be freed.
+        code = textwrap.dedent("""
+            import gc, sys, weakref
+            gc.disable()
+
+            class A:
+                pass
+
+            a = A()
+            a.self = a
+            items = [1.5, (2.5, 3.5), "-".join(map(str, range(10)))]
+            garbage = A()
+            garbage.self = garbage
+            wr = weakref.ref(garbage)
+            del garbage
+
+            assert gc.immortalize() > 0
+            assert not gc.is_tracked(a)
+            assert not gc.is_tracked(items)
+            for obj in (a, A, items, items[0], items[1], items[1][0]):
+                refcount = sys.getrefcount(obj)
+                ref = obj
+                assert sys.getrefcount(obj) == refcount, obj
+            # Non-interned strings stay mortal
+            refcount = sys.getrefcount(items[2])
+            ref = items[2]
+            assert sys.getrefcount(items[2]) == refcount + 1
+            del ref
+
+            # The cycles that existed are kept, new ones are collected
+            assert gc.collect() == 0
+            assert wr() is not None
+            b = A()
+            b.self = b
+            wr = weakref.ref(b)
+            del b
+            assert gc.collect() == 1
+            assert wr() is None
+        """)
+        assert_python_ok("-c", code)
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1186,6 +1298,65 @@ def make_ll(depth):
         if not enabled:
             gc.disable()
 
+    @requires_subprocess()
+    @requires_gil_enabled("Free threading does not support incremental GC")
+    def test_background_marking(self):
+        code = textwrap.dedent("""
+            import gc, os, sys, threading, time, weakref
+
+            class Node:
+                pass
+
+            # A large live heap, for the helper thread to mark
+            live = []
+            for i in range(100_000):
+                node = Node()
+                node.next = live[-1] if live else None
+                live.append(node)
+
+            collected = 0
+            def callback(ref):
+                global collected
+                collected += 1
+
+            refs = []
+            def make_garbage(n):
+                for i in range(n):
+                    a = Node()
+                    a.self = a
+                    a.data = [a, {"key": a}]
+                    refs.append(weakref.ref(a, callback))
+                    if i % 1000 == 0:
+                        # Release the GIL
+                        time.sleep(0.001)
+
+            make_garbage(50_000)
+            threads = [threading.Thread(target=make_garbage, args=(20_000,))
+                       for _ in range(2)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            assert collected > 0, collected
+
+            if hasattr(os, "fork"):
+                pid = os.fork()
+                if pid == 0:
+                    gc.collect()
+                    collected = 0
+                    make_garbage(20_000)
+                    gc.collect()
+                    os._exit(0 if collected == 20_000 else 1)
+                _, status = os.waitpid(pid, 0)
+                assert os.waitstatus_to_exitcode(status) == 0
+
+            gc.collect()
+            assert collected == 90_000, collected
+            assert len(live) == 100_000
+            assert all(node.next is live[i - 1] for i, node in enumerate(live) if i)
+        """)
+        assert_python_ok("-c", code, PYTHON_GC_BACKGROUND_MARK="1")
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -38,6 +38,7 @@ def skip_if_different_mount_drives():
     import tier1_generator
     import opcode_metadata_generator
     import optimizer_generator
+    import stack_cache_generator
 
 
 def handle_stderr():
@@ -538,7 +539,7 @@ def test_error_if_plain(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            if (cond) goto label;
+            if (cond) JUMP_TO_LABEL(label);
             DISPATCH();
         }
     """
@@ -555,7 +556,7 @@ def test_error_if_plain_with_comment(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            if (cond) goto label;
+            if (cond) JUMP_TO_LABEL(label);
             // Comment is ok
             DISPATCH();
         }
@@ -582,7 +583,7 @@ def test_error_if_pop(self):
             right = stack_pointer[-1];
             left = stack_pointer[-2];
             SPAM(left, right);
-            if (cond) goto pop_2_label;
+            if (cond) JUMP_TO_LABEL(pop_2_label);
             res = 0;
             stack_pointer[-2] = res;
             stack_pointer += -1;
@@ -611,7 +612,7 @@ def test_error_if_pop_with_result(self):
             right = stack_pointer[-1];
             left = stack_pointer[-2];
             res = SPAM(left, right);
-            if (cond) goto pop_2_label;
+            if (cond) JUMP_TO_LABEL(pop_2_label);
             stack_pointer[-2] = res;
             stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
@@ -653,7 +654,7 @@ def test_suppress_dispatch(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            goto somewhere;
+            JUMP_TO_LABEL(somewhere);
         }
     """
         self.run_cases_test(input, output)
@@ -929,7 +930,7 @@ def test_array_error_if(self):
             if (oparg == 0) {
                 stack_pointer += -1 - oparg;
                 assert(WITHIN_STACK_BOUNDS());
-                goto somewhere;
+                JUMP_TO_LABEL(somewhere);
             }
             stack_pointer += -1 - oparg;
             assert(WITHIN_STACK_BOUNDS());
@@ -974,6 +975,43 @@ def test_cond_effect(self):
     """
         self.run_cases_test(input, output)
 
+    def test_macro_cond_effect_peeked(self):
+        input = """
+        op(A, (left, unused if (oparg & 1) -- left, unused if (oparg & 1))) {
+            USE(left);
+        }
+        op(B, (left, extra if (oparg & 1) -- res)) {
+            res = SPAM(left, extra);
+            INPUTS_DEAD();
+        }
+        macro(M) = A + B;
+    """
+        output = """
+        TARGET(M) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(M);
+            _PyStackRef left;
+            _PyStackRef extra = PyStackRef_NULL;
+            _PyStackRef res;
+            // A
+            {
+                left = stack_pointer[-1 - (oparg & 1)];
+                USE(left);
+            }
+            // B
+            {
+                if (oparg & 1) { extra = stack_pointer[-(oparg & 1)]; }
+                res = SPAM(left, extra);
+            }
+            stack_pointer[-1 - (oparg & 1)] = res;
+            stack_pointer += -(oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+    """
+        self.run_cases_test(input, output)
+
     def test_macro_cond_effect(self):
         input = """
         op(A, (left, middle, right --)) {
@@ -1350,6 +1388,97 @@ def test_flush(self):
         """
         self.run_cases_test(input, output)
 
+    def test_super_instruction(self):
+        input = """
+        inst(FIRST, ( -- a)) {
+            a = GETLOCAL(oparg);
+        }
+
+        inst(SECOND, (a -- b)) {
+            b = a + oparg;
+            INPUTS_DEAD();
+        }
+
+        super(FIRST__SECOND) = FIRST + SECOND;
+        """
+        output = """
+        TARGET(FIRST) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(FIRST);
+            _PyStackRef a;
+            a = GETLOCAL(oparg);
+            stack_pointer[0] = a;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FIRST__SECOND) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(FIRST__SECOND);
+            static_assert(0 == 0, "incorrect cache size");
+            _PyStackRef a;
+            a = GETLOCAL(oparg);
+            stack_pointer[0] = a;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            // SECOND
+            if (next_instr->op.code != SECOND) {
+                DISPATCH();
+            }
+            {
+                oparg = next_instr->op.arg;
+                frame->instr_ptr = next_instr;
+                next_instr += 1;
+                INSTRUCTION_STATS(SECOND);
+                _PyStackRef a;
+                _PyStackRef b;
+                a = stack_pointer[-1];
+                b = a + oparg;
+                stack_pointer[-1] = b;
+                DISPATCH();
+            }
+        }
+
+        TARGET(SECOND) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(SECOND);
+            _PyStackRef a;
+            _PyStackRef b;
+            a = stack_pointer[-1];
+            b = a + oparg;
+            stack_pointer[-1] = b;
+            DISPATCH();
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_super_instruction_specializable(self):
+        input = """
+        inst(FIRST, ( -- a)) {
+            a = 1;
+        }
+
+        inst(SECOND, (unused/1, a -- b)) {
+            b = a;
+        }
+
+        inst(SECOND_SPECIALIZED, (unused/1, a -- b)) {
+            b = a;
+        }
+
+        family(SECOND, 1) = { SECOND_SPECIALIZED };
+
+        super(FIRST__SECOND) = FIRST + SECOND;
+        """
+        output = """
+        """
+        with self.assertRaises(SyntaxError):
+            self.run_cases_test(input, output)
+
     def test_pop_on_error_peeks(self):
 
         input = """
@@ -1392,7 +1521,7 @@ def test_pop_on_error_peeks(self):
             // THIRD
             {
                 // Mark j and k as used
-                if (cond) goto pop_2_error;
+                if (cond) JUMP_TO_LABEL(pop_2_error);
             }
             stack_pointer += -2;
             assert(WITHIN_STACK_BOUNDS());
@@ -1435,7 +1564,7 @@ def test_push_then_error(self):
                     stack_pointer[1] = b;
                     stack_pointer += 2;
                     assert(WITHIN_STACK_BOUNDS());
-                    goto error;
+                    JUMP_TO_LABEL(error);
                 }
             }
             stack_pointer[0] = a;
@@ -1462,14 +1591,14 @@ def test_error_if_true(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP1);
-            goto here;
+            JUMP_TO_LABEL(here);
         }
 
         TARGET(OP2) {
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP2);
-            goto there;
+            JUMP_TO_LABEL(there);
         }
         """
         self.run_cases_test(input, output)
@@ -1533,6 +1662,57 @@ def test_stack_save_reload(self):
         """
         self.run_cases_test(input, output)
 
+    def test_labels(self):
+
+        input = """
+        inst(OP, ( -- )) {
+            ERROR_IF(cond, other_label);
+        }
+
+        label(my_label) {
+            // Comment
+            do_thing();
+            if (complex) {
+                goto other_label;
+            }
+            goto other_label;
+        }
+
+        label(other_label) {
+            DISPATCH();
+        }
+        """
+
+        output = """
+        TARGET(OP) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(OP);
+            if (cond) JUMP_TO_LABEL(other_label);
+            DISPATCH();
+        }
+
+        /* BEGIN LABELS */
+
+        LABEL(my_label)
+        {
+            // Comment
+            do_thing();
+            if (complex) {
+                JUMP_TO_LABEL(other_label);
+            }
+            JUMP_TO_LABEL(other_label);
+        }
+
+        LABEL(other_label)
+        {
+            DISPATCH();
+        }
+
+        /* END LABELS */
+        """
+        self.run_cases_test(input, output)
+
     def test_stack_reload_only(self):
 
         input = """
@@ -1714,6 +1894,282 @@ def test_pop_dead_inputs_with_output(self):
         self.run_cases_test(input, output)
 
 
+class TestGeneratedStackCacheCases(unittest.TestCase):
+    SPILLS = """
+        case _SPILL_r10: {
+            stack_pointer[0] = _tos0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _SPILL_r20: {
+            stack_pointer[0] = _tos0;
+            stack_pointer[1] = _tos1;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+    """
+
+    def setUp(self) -> None:
+        super().setUp()
+        self.maxDiff = None
+
+        self.temp_dir = tempfile.gettempdir()
+        self.temp_input_filename = os.path.join(self.temp_dir, "input.txt")
+        self.temp_output_filename = os.path.join(self.temp_dir, "output.txt")
+
+    def tearDown(self) -> None:
+        for filename in [
+            self.temp_input_filename,
+            self.temp_output_filename,
+        ]:
+            try:
+                os.remove(filename)
+            except:
+                pass
+        super().tearDown()
+
+    def run_cases_test(self, input: str, expected: str):
+        with open(self.temp_input_filename, "w+") as temp_input:
+            temp_input.write(parser.BEGIN_MARKER)
+            temp_input.write(input)
+            temp_input.write(parser.END_MARKER)
+            temp_input.flush()
+
+        with handle_stderr():
+            stack_cache_generator.generate_stack_cache_from_files(
+                [self.temp_input_filename], self.temp_output_filename, False,
+                max_depth=2
+            )
+
+        with open(self.temp_output_filename) as temp_output:
+            lines = temp_output.readlines()
+            while lines and lines[0].startswith(("// ", "#", "    #", "\n")):
+                lines.pop(0)
+            while lines and lines[-1].startswith(("#", "\n")):
+                lines.pop(-1)
+        actual = "".join(lines)
+        expected = (self.SPILLS.rstrip() + "\n" + expected).strip()
+        self.assertEqual(actual.strip(), expected)
+
+    def test_push_one(self):
+        input = """
+        op(OP, (-- res)) {
+            res = SPAM();
+        }
+        """
+        output = """
+        case OP_r01: {
+            _PyStackRef res;
+            res = SPAM();
+            _tos0 = res;
+            break;
+        }
+
+        case OP_r12: {
+            _PyStackRef res;
+            res = SPAM();
+            _tos1 = res;
+            break;
+        }
+
+        case OP_r22: {
+            _PyStackRef res;
+            res = SPAM();
+            stack_pointer[0] = _tos0;
+            _tos0 = _tos1;
+            _tos1 = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_binary_op(self):
+        input = """
+        op(OP, (left, right -- res)) {
+            res = SPAM(left, right);
+            INPUTS_DEAD();
+        }
+        """
+        output = """
+        case OP_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            res = SPAM(left, right);
+            _tos0 = res;
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos0;
+            left = stack_pointer[-1];
+            res = SPAM(left, right);
+            _tos0 = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos1;
+            left = _tos0;
+            res = SPAM(left, right);
+            _tos0 = res;
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_deopt_spills(self):
+        input = """
+        op(OP, (left, unused -- left, unused)) {
+            DEOPT_IF(SPAM(left));
+        }
+        """
+        output = """
+        case OP_r02: {
+            _PyStackRef left;
+            left = stack_pointer[-2];
+            if (SPAM(left)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos1 = stack_pointer[-1];
+            _tos0 = stack_pointer[-2];
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r12: {
+            _PyStackRef left;
+            left = stack_pointer[-1];
+            if (SPAM(left)) {
+                UOP_STAT_INC(uopcode, miss);
+                stack_pointer[0] = _tos0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos1 = _tos0;
+            _tos0 = stack_pointer[-1];
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r22: {
+            _PyStackRef left;
+            left = _tos0;
+            if (SPAM(left)) {
+                UOP_STAT_INC(uopcode, miss);
+                stack_pointer[0] = _tos0;
+                stack_pointer[1] = _tos1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_error_spills(self):
+        input = """
+        op(OP, (arg -- res)) {
+            res = SPAM(arg);
+            ERROR_IF(PyStackRef_IsNull(res), error);
+            DEAD(arg);
+        }
+        """
+        output = """
+        case OP_r01: {
+            _PyStackRef arg;
+            _PyStackRef res;
+            arg = stack_pointer[-1];
+            res = SPAM(arg);
+            if (PyStackRef_IsNull(res)) {
+                JUMP_TO_ERROR();
+            }
+            _tos0 = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r11: {
+            _PyStackRef arg;
+            _PyStackRef res;
+            arg = _tos0;
+            res = SPAM(arg);
+            if (PyStackRef_IsNull(res)) {
+                stack_pointer[0] = _tos0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            _tos0 = res;
+            break;
+        }
+
+        case OP_r22: {
+            _PyStackRef arg;
+            _PyStackRef res;
+            arg = _tos1;
+            res = SPAM(arg);
+            if (PyStackRef_IsNull(res)) {
+                stack_pointer[0] = _tos0;
+                stack_pointer[1] = _tos1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            _tos1 = res;
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_variable_stack_effect_not_cached(self):
+        input = """
+        op(OP, (values[oparg] -- res)) {
+            res = SPAM(values, oparg);
+            INPUTS_DEAD();
+        }
+        """
+        output = """
+        /* OP needs an empty cache because it has a variable stack effect */
+        """
+        self.run_cases_test(input, output)
+
+    def test_stack_pointer_not_cached(self):
+        input = """
+        op(OP, (arg --)) {
+            SPAM(stack_pointer);
+            DEAD(arg);
+        }
+        """
+        output = """
+        /* OP needs an empty cache because it uses stack_pointer */
+        """
+        self.run_cases_test(input, output)
+
+
 class TestGeneratedAbstractCases(unittest.TestCase):
     def setUp(self) -> None:
         super().setUp()
@@ -152,6 +152,14 @@ def func():
         gen.__qualname__ = "qualname"
         self.assertEqual(gen.__name__, "name")
         self.assertEqual(gen.__qualname__, "qualname")
+        self.assertIn("qualname", repr(gen))
+
+        # modifying one name keeps the other
+        gen = func()
+        gen.__name__ = "name"
+        self.assertEqual(gen.__name__, "name")
+        self.assertEqual(gen.__qualname__,
+                         "GeneratorTest.test_name.<locals>.func")
 
         # generator names must be a string and cannot be deleted
         self.assertRaises(TypeError, setattr, gen, '__name__', 123)
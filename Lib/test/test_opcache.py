@@ -1,6 +1,7 @@
 import copy
 import pickle
 import dis
+import sys
 import threading
 import types
 import unittest
@@ -1268,6 +1269,99 @@ def binary_op_add_unicode():
         self.assert_specialized(binary_op_add_unicode, "BINARY_OP_ADD_UNICODE")
         self.assert_no_opcode(binary_op_add_unicode, "BINARY_OP")
 
+        def binary_op_remainder_unicode():
+            for i in range(100):
+                a = "%s-%d" % ("foo", i)
+                self.assertEqual(a, f"foo-{i}")
+
+        binary_op_remainder_unicode()
+        self.assert_specialized(binary_op_remainder_unicode,
+                                "BINARY_OP_REMAINDER_UNICODE")
+        self.assert_no_opcode(binary_op_remainder_unicode, "BINARY_OP")
+
+        class Str(str):
+            def __rmod__(self, other):
+                return "rmod"
+
+        def binary_op_remainder_str_subclass():
+            for _ in range(100):
+                self.assertEqual("%s" % Str("x"), "rmod")
+
+        binary_op_remainder_str_subclass()
+        self.assert_no_opcode(binary_op_remainder_str_subclass,
+                              "BINARY_OP_REMAINDER_UNICODE")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_binary_op_int_temporaries(self):
+        # Specialized int operations may reuse a uniquely referenced
+        # operand for their result. Shared operands must never change.
+        def binary_op_int(values, big):
+            results = []
+            for a, b in values:
+                a2 = a
+                results.append(((a * b) + b) - a)
+                results.append((a + 1000) * (b - 1000))
+                results.append((a - b) + (b - a))
+                results.append((a + big) - big)
+                self.assertIs(a2, a)
+            return results
+
+        m = 2**30 - 1  # largest medium int
+        values = [(1000, 3), (-7000, 4000), (300, -300), (m, 1), (-m, -1),
+                  (m, m), (2, 255), (5, -5)]
+        expected = [x for a, b in values
+                    for x in (a*b + b - a, (a + 1000) * (b - 1000), 0, a)]
+        for _ in range(100):
+            self.assertEqual(binary_op_int(values, 10**20), expected)
+            self.assertEqual(values[0], (1000, 3))
+        self.assert_specialized(binary_op_int, "BINARY_OP_ADD_INT")
+        self.assert_specialized(binary_op_int, "BINARY_OP_SUBTRACT_INT")
+        self.assert_specialized(binary_op_int, "BINARY_OP_MULTIPLY_INT")
+
+    @cpython_only
+    @requires_specialization
+    def test_load_attr_polymorphic(self):
+        class A:
+            def __init__(self):
+                self.x = "a"
+
+        class B:
+            def __init__(self):
+                self.y = None
+                self.x = "b"
+
+        class C:
+            __slots__ = ("y", "x")
+            def __init__(self):
+                self.x = "c"
+
+        class D:
+            def __init__(self):
+                self.x = "d"
+
+        def load_attr(objs):
+            return "".join([obj.x for obj in objs])
+
+        for _ in range(100):
+            self.assertEqual(load_attr([A(), B(), C()]), "abc")
+        self.assert_specialized(load_attr, "LOAD_ATTR_POLYMORPHIC")
+
+        # Missing attributes and unseen types deopt, but still work
+        c = C()
+        del c.x
+        with self.assertRaises(AttributeError):
+            load_attr([c])
+        b = B()
+        b.__dict__["x"] = "B"
+        self.assertEqual(load_attr([b, D(), A()]), "Bda")
+
+        # A fourth type evicts the oldest one
+        for _ in range(100):
+            self.assertEqual(load_attr([B(), C(), D()]), "bcd")
+        self.assert_specialized(load_attr, "LOAD_ATTR_POLYMORPHIC")
+        self.assertEqual(load_attr([A(), B(), C(), D()]), "abcd")
+
     @cpython_only
     @requires_specialization_ft
     def test_load_super_attr(self):
@@ -1330,6 +1424,60 @@ def contains_op_set():
         self.assert_specialized(contains_op_set, "CONTAINS_OP_SET")
         self.assert_no_opcode(contains_op_set, "CONTAINS_OP")
 
+        def contains_op_tuple():
+            nan = float("nan")
+            for _ in range(100):
+                a = "b"
+                self.assertTrue(a in ("a", "b", 3))
+                self.assertFalse(4 in ("a", "b", 3))
+                self.assertTrue(3.0 in ("a", "b", 3))
+                self.assertTrue(nan in (nan,))
+                self.assertFalse(float("nan") in (nan,))
+
+        contains_op_tuple()
+        self.assert_specialized(contains_op_tuple, "CONTAINS_OP_TUPLE")
+        self.assert_no_opcode(contains_op_tuple, "CONTAINS_OP")
+
+    @cpython_only
+    @requires_specialization
+    def test_compare_op(self):
+        def compare_op_int_float():
+            for i in range(100):
+                self.assertTrue(i < 100.5)
+                self.assertTrue(0.5 <= i + 1)
+                self.assertFalse(i == float("nan"))
+                self.assertTrue(i != float("nan"))
+
+        compare_op_int_float()
+        self.assert_specialized(compare_op_int_float, "COMPARE_OP_INT_FLOAT")
+        self.assert_no_opcode(compare_op_int_float, "COMPARE_OP")
+
+        def compare_op_bytes():
+            for i in range(100):
+                self.assertTrue(b"abc" == bytes([97, 98, 99]))
+                self.assertTrue(b"" != b"\0")
+
+        compare_op_bytes()
+        self.assert_specialized(compare_op_bytes, "COMPARE_OP_BYTES")
+        self.assert_no_opcode(compare_op_bytes, "COMPARE_OP")
+
+        class Cmp:
+            def __lt__(self, other):
+                return "lt"
+            def __eq__(self, other):
+                return False
+
+        def compare_op_tuple():
+            for i in range(100):
+                self.assertTrue((1, "a", 2.0) == (1, "a", 2))
+                self.assertTrue((1, "a") < (1, "b"))
+                self.assertTrue((i, 2**100) < (i, 2**100 + 1))
+                self.assertEqual((1, Cmp()) < (1, Cmp()), "lt")
+
+        compare_op_tuple()
+        self.assert_specialized(compare_op_tuple, "COMPARE_OP_TUPLE")
+        self.assert_no_opcode(compare_op_tuple, "COMPARE_OP")
+
     @cpython_only
     @requires_specialization_ft
     def test_send_with(self):
@@ -1598,6 +1746,186 @@ def __getitem__(self, item):
         self.assert_specialized(binary_subscr_getitems, "BINARY_SUBSCR_GETITEM")
         self.assert_no_opcode(binary_subscr_getitems, "BINARY_SUBSCR")
 
+    @cpython_only
+    @requires_specialization_ft
+    def test_call_kw(self):
+        def call_kw_builtin_fast():
+            for _ in range(100):
+                self.assertEqual(sorted([2, 1], reverse=True), [2, 1])
+
+        call_kw_builtin_fast()
+        self.assert_specialized(call_kw_builtin_fast, "CALL_KW_BUILTIN_FAST")
+        self.assert_no_opcode(call_kw_builtin_fast, "CALL_KW")
+
+        def call_kw_method_descriptor_fast():
+            for _ in range(100):
+                self.assertEqual("a,b".split(sep=","), ["a", "b"])
+
+        call_kw_method_descriptor_fast()
+        self.assert_specialized(call_kw_method_descriptor_fast,
+                                "CALL_KW_METHOD_DESCRIPTOR_FAST")
+        self.assert_no_opcode(call_kw_method_descriptor_fast, "CALL_KW")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_call_function_ex(self):
+        def call_function_ex_non_py():
+            args = ([2, 1],)
+            kwargs = {"reverse": True}
+            for _ in range(100):
+                self.assertEqual(sorted(*args, **kwargs), [2, 1])
+                self.assertEqual(max(*args), 2)
+
+        call_function_ex_non_py()
+        self.assert_specialized(call_function_ex_non_py,
+                                "CALL_FUNCTION_EX_NON_PY")
+        self.assert_no_opcode(call_function_ex_non_py, "CALL_FUNCTION_EX")
+
+        def call_function_ex_py():
+            def f(*args, **kwargs):
+                return len(args) + len(kwargs)
+            args = (1, 2)
+            for _ in range(100):
+                self.assertEqual(f(*args, x=1), 3)
+
+        call_function_ex_py()
+        self.assert_no_opcode(call_function_ex_py, "CALL_FUNCTION_EX_NON_PY")
+
+    @cpython_only
+    @requires_specialization
+    def test_for_iter(self):
+        def for_iter_dict_items():
+            d = {1: 2, 3: 4}
+            for _ in range(100):
+                for k, v in d.items():
+                    self.assertEqual(k + 1, v)
+
+        for_iter_dict_items()
+        self.assert_specialized(for_iter_dict_items, "FOR_ITER_DICT_ITEMS")
+
+        def for_iter_enumerate():
+            a = "ab"
+            for _ in range(100):
+                for i, c in enumerate(a):
+                    self.assertEqual(a[i], c)
+
+        for_iter_enumerate()
+        self.assert_specialized(for_iter_enumerate, "FOR_ITER_ENUMERATE")
+
+        def for_iter_zip():
+            a = [1, 2]
+            b = (2, 3)
+            for _ in range(100):
+                for x, y in zip(a, b):
+                    self.assertEqual(x + 1, y)
+
+        for_iter_zip()
+        self.assert_specialized(for_iter_zip, "FOR_ITER_ZIP")
+
+        def for_iter_zip_three():
+            a = [1, 2]
+            for _ in range(100):
+                for x, y, z in zip(a, a, a):
+                    self.assertEqual(x, z)
+
+        for_iter_zip_three()
+        self.assert_no_opcode(for_iter_zip_three, "FOR_ITER_ZIP")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_load_fast_return_value(self):
+        def load_fast_return_value(x):
+            y = x + 1
+            return y
+
+        # Superinstructions are installed when the code object is created
+        self.assert_specialized(load_fast_return_value, "LOAD_FAST__RETURN_VALUE")
+        self.assertEqual(load_fast_return_value(1), 2)
+
+        # The return is still visible to sys.monitoring
+        code = load_fast_return_value.__code__
+        tool = sys.monitoring.DEBUGGER_ID
+        returned = []
+        sys.monitoring.use_tool_id(tool, "test_opcache")
+        try:
+            sys.monitoring.register_callback(
+                tool, sys.monitoring.events.PY_RETURN,
+                lambda code, offset, retval: returned.append(retval))
+            sys.monitoring.set_local_events(
+                tool, code, sys.monitoring.events.PY_RETURN)
+            self.assertEqual(load_fast_return_value(2), 3)
+        finally:
+            sys.monitoring.set_local_events(tool, code, 0)
+            sys.monitoring.free_tool_id(tool)
+        self.assertEqual(returned, [3])
+        self.assertEqual(load_fast_return_value(3), 4)
+
+
+@cpython_only
+@requires_specialization
+class TestSpecializationFailures(TestBase):
+
+    def setUp(self):
+        self.opcode = import_module("_opcode")
+        self.addCleanup(self.opcode.set_specialization_failure_sampling, 0)
+
+    @disabling_optimizer
+    def test_failures_are_recorded(self):
+        def f():
+            for _ in range(100):
+                {} | {}
+
+        self.opcode.set_specialization_failure_sampling(1)
+        f()
+        self.opcode.set_specialization_failure_sampling(0)
+
+        failures = self.opcode.get_specialization_failures()
+        self.assertIn("BINARY_OP", failures)
+        self.assertGreater(sum(failures["BINARY_OP"].values()), 0)
+
+        binary_op, = [instr.offset for instr in dis.get_instructions(f)
+                      if instr.opname == "BINARY_OP"]
+        by_offset = self.opcode.get_specialization_failures(f.__code__)
+        self.assertEqual(list(by_offset), [binary_op])
+        self.assertEqual(by_offset[binary_op].keys(),
+                         failures["BINARY_OP"].keys())
+
+    @disabling_optimizer
+    def test_sampling(self):
+        def f():
+            for _ in range(1000):
+                {} | {}
+
+        def g():
+            for _ in range(1000):
+                {} | {}
+
+        self.opcode.set_specialization_failure_sampling(1)
+        f()
+        self.opcode.set_specialization_failure_sampling(4)
+        g()
+        self.opcode.set_specialization_failure_sampling(0)
+
+        every, = self.opcode.get_specialization_failures(f.__code__).values()
+        sampled, = self.opcode.get_specialization_failures(g.__code__).values()
+        every = sum(every.values())
+        sampled = sum(sampled.values())
+        self.assertGreater(every, 0)
+        self.assertEqual(sampled, every // 4)
+
+    @disabling_optimizer
+    def test_disabled(self):
+        def f():
+            for _ in range(100):
+                {} | {}
+
+        f()
+        self.assertEqual(self.opcode.get_specialization_failures(f.__code__), {})
+        with self.assertRaises(ValueError):
+            self.opcode.set_specialization_failure_sampling(-1)
+        with self.assertRaises(TypeError):
+            self.opcode.get_specialization_failures(f)
+
 
 if __name__ == "__main__":
     unittest.main()
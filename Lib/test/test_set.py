@@ -730,6 +730,29 @@ def test_hash_caching(self):
         f = self.thetype('abcdcda')
         self.assertEqual(hash(f), hash(f))
 
+    @support.cpython_only
+    def test_gc_tracking(self):
+        # Exact frozensets of atomic objects are not tracked by the GC
+        class A:
+            pass
+        pair = tuple([1, 'a'])
+        untracked = self.thetype is frozenset
+        self.assertIs(gc.is_tracked(self.thetype()), not untracked)
+        self.assertIs(gc.is_tracked(self.thetype([1, 1.5, 'a'])), not untracked)
+        self.assertIs(gc.is_tracked(self.thetype([pair])), not untracked)
+        self.assertFalse(gc.is_tracked(self.thetype([1]) | self.thetype([pair])))
+        self.assertTrue(gc.is_tracked(self.thetype([A()])))
+        self.assertTrue(gc.is_tracked(self.thetype([(1, A())])))
+        self.assertTrue(gc.is_tracked(self.thetype([1]) | self.thetype([A()])))
+
+        # A reference cycle through a frozenset is still collected
+        a = A()
+        a.fs = self.thetype([1, a])
+        ref = weakref.ref(a)
+        del a
+        gc.collect()
+        self.assertIsNone(ref())
+
     def test_hash_effectiveness(self):
         n = 13
         hashvalues = set()
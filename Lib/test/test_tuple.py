@@ -355,6 +355,25 @@ class MyTuple(tuple):
             pass
         self.check_track_dynamic(MyTuple, True)
 
+    @support.cpython_only
+    def test_track_construction(self):
+        # Tuples of atomic objects are not tracked from the start, without
+        # waiting for a collection to untrack them.
+        x, y, z = 1.5, "a", []
+        self.assertFalse(gc.is_tracked((x, y)))
+        self.assertFalse(gc.is_tracked(((x, y), (y, x))))
+        self.assertFalse(gc.is_tracked((frozenset([x]), y)))
+        self.assertFalse(gc.is_tracked(tuple([1, x, y])))
+        self.assertFalse(gc.is_tracked((1, x, y)[1:]))
+        self.assertFalse(gc.is_tracked((x,) + (y,)))
+        self.assertFalse(gc.is_tracked((x, y) * 3))
+
+        self.assertTrue(gc.is_tracked((x, z)))
+        self.assertTrue(gc.is_tracked(((x, z), y)))
+        self.assertTrue(gc.is_tracked(({}, y)))
+        self.assertTrue(gc.is_tracked((x, y) + (z,)))
+        self.assertTrue(gc.is_tracked((x, z) * 3))
+
     @support.cpython_only
     def test_bug7466(self):
         # Trying to untrack an unfinished tuple could crash Python
@@ -223,6 +223,56 @@ _opcode_get_specialization_stats_impl(PyObject *module)
 
 /*[clinic input]
 
+_opcode.set_specialization_failure_sampling
+
+    rate: int
+
+Record one in every rate failed specializations, or none if rate is 0.
+
+Unlike the specialization stats, this is available in every build.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_set_specialization_failure_sampling_impl(PyObject *module, int rate)
+/*[clinic end generated code: output=eb2e9aec4db53d34 input=589a07d4479a37ad]*/
+{
+    if (_Py_SetSpecializationFailureSampling(rate) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+
+_opcode.get_specialization_failures
+
+    code: object = None
+
+Return the sampled specialization failures.
+
+Without a code object, return {opname: {kind: count}} for the whole
+interpreter. With a code object, return {offset: {kind: count}} for the
+instructions of that code object.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_get_specialization_failures_impl(PyObject *module, PyObject *code)
+/*[clinic end generated code: output=cd8f47f3aa6f2fa8 input=d06803ed6fde5f48]*/
+{
+    if (code == Py_None) {
+        return _Py_GetSpecializationFailures();
+    }
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not %.100s",
+                     Py_TYPE(code)->tp_name);
+        return NULL;
+    }
+    return _PyCode_GetSpecializationFailures((PyCodeObject *)code);
+}
+
+/*[clinic input]
+
 _opcode.get_nb_ops
 
 Return array of symbols of binary ops.
@@ -409,6 +459,8 @@ opcode_functions[] =  {
     _OPCODE_HAS_LOCAL_METHODDEF
     _OPCODE_HAS_EXC_METHODDEF
     _OPCODE_GET_SPECIALIZATION_STATS_METHODDEF
+    _OPCODE_SET_SPECIALIZATION_FAILURE_SAMPLING_METHODDEF
+    _OPCODE_GET_SPECIALIZATION_FAILURES_METHODDEF
     _OPCODE_GET_NB_OPS_METHODDEF
     _OPCODE_GET_INTRINSIC1_DESCS_METHODDEF
     _OPCODE_GET_INTRINSIC2_DESCS_METHODDEF
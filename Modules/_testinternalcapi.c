@@ -2174,6 +2174,7 @@ static PyMethodDef module_functions[] = {
 static int
 module_exec(PyObject *module)
 {
+    PyInterpreterState *interp = _PyInterpreterState_GET();
     if (_PyTestInternalCapi_Init_Lock(module) < 0) {
         return 1;
     }
@@ -2213,7 +2214,7 @@ module_exec(PyObject *module)
     }
 
     if (PyModule_Add(module, "TIER2_THRESHOLD",
-                        PyLong_FromLong(JUMP_BACKWARD_INITIAL_VALUE + 1)) < 0) {
+                        PyLong_FromLong(interp->jump_backward_initial_value + 1)) < 0) {
         return 1;
     }
 
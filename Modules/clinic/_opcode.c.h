@@ -622,6 +622,132 @@ _opcode_get_specialization_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
     return _opcode_get_specialization_stats_impl(module);
 }
 
+PyDoc_STRVAR(_opcode_set_specialization_failure_sampling__doc__,
+"set_specialization_failure_sampling($module, /, rate)\n"
+"--\n"
+"\n"
+"Record one in every rate failed specializations, or none if rate is 0.\n"
+"\n"
+"Unlike the specialization stats, this is available in every build.");
+
+#define _OPCODE_SET_SPECIALIZATION_FAILURE_SAMPLING_METHODDEF    \
+    {"set_specialization_failure_sampling", _PyCFunction_CAST(_opcode_set_specialization_failure_sampling), METH_FASTCALL|METH_KEYWORDS, _opcode_set_specialization_failure_sampling__doc__},
+
+static PyObject *
+_opcode_set_specialization_failure_sampling_impl(PyObject *module, int rate);
+
+static PyObject *
+_opcode_set_specialization_failure_sampling(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(rate), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"rate", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_specialization_failure_sampling",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    int rate;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    rate = PyLong_AsInt(args[0]);
+    if (rate == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _opcode_set_specialization_failure_sampling_impl(module, rate);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_opcode_get_specialization_failures__doc__,
+"get_specialization_failures($module, /, code=None)\n"
+"--\n"
+"\n"
+"Return the sampled specialization failures.\n"
+"\n"
+"Without a code object, return {opname: {kind: count}} for the whole\n"
+"interpreter. With a code object, return {offset: {kind: count}} for the\n"
+"instructions of that code object.");
+
+#define _OPCODE_GET_SPECIALIZATION_FAILURES_METHODDEF    \
+    {"get_specialization_failures", _PyCFunction_CAST(_opcode_get_specialization_failures), METH_FASTCALL|METH_KEYWORDS, _opcode_get_specialization_failures__doc__},
+
+static PyObject *
+_opcode_get_specialization_failures_impl(PyObject *module, PyObject *code);
+
+static PyObject *
+_opcode_get_specialization_failures(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(code), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"code", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "get_specialization_failures",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *code = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    code = args[0];
+skip_optional_pos:
+    return_value = _opcode_get_specialization_failures_impl(module, code);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_opcode_get_nb_ops__doc__,
 "get_nb_ops($module, /)\n"
 "--\n"
@@ -756,4 +882,4 @@ _opcode_get_executor(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=2e0c39286d0253e7 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=bc6d852479bf7210 input=a9049054013a1b77]*/
@@ -162,6 +162,7 @@ PyDoc_STRVAR(gc_set_debug__doc__,
 "      DEBUG_UNCOLLECTABLE - Print unreachable but uncollectable objects\n"
 "        found.\n"
 "      DEBUG_SAVEALL - Save objects to gc.garbage rather than freeing them.\n"
+"      DEBUG_TYPE_STATS - Record per-type statistics (see get_type_stats).\n"
 "      DEBUG_LEAK - Debug leaking programs (everything but STATS).\n"
 "\n"
 "Debugging information is written to sys.stderr.");
@@ -453,6 +454,75 @@ gc_get_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_stats_impl(module);
 }
 
+PyDoc_STRVAR(gc_get_type_stats__doc__,
+"get_type_stats($module, /, *, reset=False)\n"
+"--\n"
+"\n"
+"Return a dictionary mapping types to statistics recorded by the collector.\n"
+"\n"
+"The statistics are recorded while DEBUG_TYPE_STATS is set.  Each value is\n"
+"a dictionary with the number of objects of the type that collections\n"
+"traversed, found reachable (\"survived\") and collected.  If reset is true,\n"
+"the statistics are cleared.");
+
+#define GC_GET_TYPE_STATS_METHODDEF    \
+    {"get_type_stats", _PyCFunction_CAST(gc_get_type_stats), METH_FASTCALL|METH_KEYWORDS, gc_get_type_stats__doc__},
+
+static PyObject *
+gc_get_type_stats_impl(PyObject *module, int reset);
+
+static PyObject *
+gc_get_type_stats(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(reset), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"reset", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "get_type_stats",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    int reset = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 0, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    reset = PyObject_IsTrue(args[0]);
+    if (reset < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = gc_get_type_stats_impl(module, reset);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(gc_is_tracked__doc__,
 "is_tracked($module, obj, /)\n"
 "--\n"
@@ -533,6 +603,40 @@ gc_freeze(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_freeze_impl(module);
 }
 
+PyDoc_STRVAR(gc_immortalize__doc__,
+"immortalize($module, /)\n"
+"--\n"
+"\n"
+"Make all current tracked objects, and the objects they refer to, immortal.\n"
+"\n"
+"Immortal objects are never collected or freed, and their reference counts\n"
+"are never modified.  Like freeze(), this can be used before a POSIX fork()\n"
+"call to keep the memory of the objects shared with the child processes.\n"
+"Unlike freeze(), it can\'t be undone.  Return the number of objects made\n"
+"immortal.");
+
+#define GC_IMMORTALIZE_METHODDEF    \
+    {"immortalize", (PyCFunction)gc_immortalize, METH_NOARGS, gc_immortalize__doc__},
+
+static Py_ssize_t
+gc_immortalize_impl(PyObject *module);
+
+static PyObject *
+gc_immortalize(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = gc_immortalize_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(gc_unfreeze__doc__,
 "unfreeze($module, /)\n"
 "--\n"
@@ -580,4 +684,4 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=3e33248997e06c34 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=8714bbae182d8f45 input=a9049054013a1b77]*/
@@ -104,6 +104,7 @@ gc.set_debug
           DEBUG_UNCOLLECTABLE - Print unreachable but uncollectable objects
             found.
           DEBUG_SAVEALL - Save objects to gc.garbage rather than freeing them.
+          DEBUG_TYPE_STATS - Record per-type statistics (see get_type_stats).
           DEBUG_LEAK - Debug leaking programs (everything but STATS).
     /
 
@@ -114,7 +115,7 @@ Debugging information is written to sys.stderr.
 
 static PyObject *
 gc_set_debug_impl(PyObject *module, int flags)
-/*[clinic end generated code: output=7c8366575486b228 input=5e5ce15e84fbed15]*/
+/*[clinic end generated code: output=7c8366575486b228 input=636ca896953e4eb6]*/
 {
     GCState *gcstate = get_gc_state();
     gcstate->debug = flags;
@@ -379,6 +380,29 @@ gc_get_stats_impl(PyObject *module)
 }
 
 
+/*[clinic input]
+gc.get_type_stats
+
+    *
+    reset: bool = False
+
+Return a dictionary mapping types to statistics recorded by the collector.
+
+The statistics are recorded while DEBUG_TYPE_STATS is set.  Each value is
+a dictionary with the number of objects of the type that collections
+traversed, found reachable ("survived") and collected.  If reset is true,
+the statistics are cleared.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_type_stats_impl(PyObject *module, int reset)
+/*[clinic end generated code: output=c0e3bfa39e51adbf input=72c2828fc73c16b2]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return _PyGC_GetTypeStats(interp, reset);
+}
+
+
 /*[clinic input]
 gc.is_tracked -> bool
 
@@ -432,6 +456,26 @@ gc_freeze_impl(PyObject *module)
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+gc.immortalize -> Py_ssize_t
+
+Make all current tracked objects, and the objects they refer to, immortal.
+
+Immortal objects are never collected or freed, and their reference counts
+are never modified.  Like freeze(), this can be used before a POSIX fork()
+call to keep the memory of the objects shared with the child processes.
+Unlike freeze(), it can't be undone.  Return the number of objects made
+immortal.
+[clinic start generated code]*/
+
+static Py_ssize_t
+gc_immortalize_impl(PyObject *module)
+/*[clinic end generated code: output=a8a7996184145885 input=0220334131e8298e]*/
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    return _PyGC_Immortalize(tstate);
+}
+
 /*[clinic input]
 gc.unfreeze
 
@@ -473,6 +517,7 @@ PyDoc_STRVAR(gc__doc__,
 "collect() -- Do a full collection right now.\n"
 "get_count() -- Return the current collection counts.\n"
 "get_stats() -- Return list of dictionaries containing per-generation stats.\n"
+"get_type_stats() -- Return dictionary of per-type stats.\n"
 "set_debug() -- Set debugging flags.\n"
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
@@ -483,6 +528,7 @@ PyDoc_STRVAR(gc__doc__,
 "get_referrers() -- Return the list of objects that refer to an object.\n"
 "get_referents() -- Return the list of objects that an object refers to.\n"
 "freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
+"immortalize() -- Make all tracked objects immortal.\n"
 "unfreeze() -- Unfreeze all objects in the permanent generation.\n"
 "get_freeze_count() -- Return the number of objects in the permanent generation.\n");
 
@@ -498,11 +544,13 @@ static PyMethodDef GcMethods[] = {
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
+    GC_GET_TYPE_STATS_METHODDEF
     GC_IS_TRACKED_METHODDEF
     GC_IS_FINALIZED_METHODDEF
     GC_GET_REFERRERS_METHODDEF
     GC_GET_REFERENTS_METHODDEF
     GC_FREEZE_METHODDEF
+    GC_IMMORTALIZE_METHODDEF
     GC_UNFREEZE_METHODDEF
     GC_GET_FREEZE_COUNT_METHODDEF
     {NULL,      NULL}           /* Sentinel */
@@ -529,6 +577,7 @@ gcmodule_exec(PyObject *module)
     ADD_INT(DEBUG_COLLECTABLE);
     ADD_INT(DEBUG_UNCOLLECTABLE);
     ADD_INT(DEBUG_SAVEALL);
+    ADD_INT(DEBUG_TYPE_STATS);
     ADD_INT(DEBUG_LEAK);
 #undef ADD_INT
     return 0;
@@ -20,6 +20,7 @@
 #include "pycore_long.h"          // _PyLong_IsNegative()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_object.h"        // _PyObject_LookupSpecial()
+#include "pycore_optimizer.h"     // _PyOptimizer_AfterForkBackgroundCompiler()
 #include "pycore_pylifecycle.h"   // _PyOS_URandom()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_signal.h"        // Py_NSIG
@@ -692,6 +693,9 @@ PyOS_AfterFork_Child(void)
     _PyImport_ReleaseLock(tstate->interp);
 
     _PySignal_AfterFork();
+    _PyOptimizer_AfterForkBackgroundCompiler(tstate->interp);
+    _PyGC_AfterForkBackgroundMarking(tstate->interp);
+    _PyGC_AfterForkWorkerPool(tstate->interp);
 
     status = _PyInterpreterState_DeleteExceptMain(runtime);
     if (_PyStatus_EXCEPTION(status)) {
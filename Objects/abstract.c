@@ -6,6 +6,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCallTstate()
 #include "pycore_crossinterp.h"   // _Py_CallInInterpreter()
+#include "pycore_dict.h"          // _PyDict_GetOptionalSubscript()
 #include "pycore_object.h"        // _Py_CheckSlotResult()
 #include "pycore_long.h"          // _Py_IsNegative
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
@@ -207,9 +208,17 @@ PyMapping_GetOptionalItem(PyObject *obj, PyObject *key, PyObject **result)
         return PyDict_GetItemRef(obj, key, result);
     }
 
-    *result = PyObject_GetItem(obj, key);
-    if (*result) {
-        return 1;
+    int rc;
+    if (_PyDict_HasDefaultSubscript(Py_TYPE(obj))) {
+        /* Don't create a KeyError just to clear it again. */
+        rc = _PyDict_GetOptionalSubscript(obj, key, result);
+    }
+    else {
+        *result = PyObject_GetItem(obj, key);
+        rc = *result != NULL ? 1 : -1;
+    }
+    if (rc >= 0) {
+        return rc;
     }
     assert(PyErr_Occurred());
     if (!PyErr_ExceptionMatches(PyExc_KeyError)) {
@@ -1530,6 +1530,14 @@ bytes_compare_eq(PyBytesObject *a, PyBytesObject *b)
     return (cmp == 0);
 }
 
+int
+_PyBytes_Equal(PyObject *a, PyObject *b)
+{
+    assert(PyBytes_Check(a));
+    assert(PyBytes_Check(b));
+    return bytes_compare_eq((PyBytesObject *)a, (PyBytesObject *)b);
+}
+
 static PyObject*
 bytes_richcompare(PyObject *aa, PyObject *bb, int op)
 {
@@ -321,6 +321,7 @@ init_co_cached(PyCodeObject *self)
             cached->_co_cellvars = NULL;
             cached->_co_freevars = NULL;
             cached->_co_varnames = NULL;
+            cached->_co_spec_failures = NULL;
             FT_ATOMIC_STORE_PTR(self->_co_cached, cached);
         }
     }
@@ -1718,6 +1719,90 @@ PyCode_GetCode(PyCodeObject *co)
     return _PyCode_GetCode(co);
 }
 
+/* Count a sampled specialization failure of the given SPEC_FAIL_* kind at
+ * the instruction at offset (in code units). The counts are kept as
+ * {byte offset: {kind: count}}.
+ */
+int
+_PyCode_RecordSpecializationFailure(PyCodeObject *co, int offset, int kind)
+{
+    if (init_co_cached(co)) {
+        return -1;
+    }
+    int res = -1;
+    PyObject *key = NULL, *kinds = NULL, *kind_key = NULL, *count = NULL;
+    Py_BEGIN_CRITICAL_SECTION(co);
+    PyObject *failures = co->_co_cached->_co_spec_failures;
+    if (failures == NULL) {
+        failures = PyDict_New();
+        if (failures == NULL) {
+            goto done;
+        }
+        co->_co_cached->_co_spec_failures = failures;
+    }
+    key = PyLong_FromLong(offset * (long)sizeof(_Py_CODEUNIT));
+    if (key == NULL) {
+        goto done;
+    }
+    if (PyDict_GetItemRef(failures, key, &kinds) < 0) {
+        goto done;
+    }
+    if (kinds == NULL) {
+        kinds = PyDict_New();
+        if (kinds == NULL || PyDict_SetItem(failures, key, kinds) < 0) {
+            goto done;
+        }
+    }
+    kind_key = PyLong_FromLong(kind);
+    if (kind_key == NULL || PyDict_GetItemRef(kinds, kind_key, &count) < 0) {
+        goto done;
+    }
+    long n = count == NULL ? 0 : PyLong_AsLong(count);
+    Py_XSETREF(count, PyLong_FromLong(n + 1));
+    if (count == NULL || PyDict_SetItem(kinds, kind_key, count) < 0) {
+        goto done;
+    }
+    res = 0;
+done:
+    Py_END_CRITICAL_SECTION();
+    Py_XDECREF(key);
+    Py_XDECREF(kinds);
+    Py_XDECREF(kind_key);
+    Py_XDECREF(count);
+    return res;
+}
+
+/* Return a copy of the failures recorded for co, see above. */
+PyObject *
+_PyCode_GetSpecializationFailures(PyCodeObject *co)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    if (init_co_cached(co)) {
+        Py_DECREF(res);
+        return NULL;
+    }
+    Py_BEGIN_CRITICAL_SECTION(co);
+    PyObject *failures = co->_co_cached->_co_spec_failures;
+    if (failures != NULL) {
+        Py_ssize_t pos = 0;
+        PyObject *offset, *kinds;
+        while (PyDict_Next(failures, &pos, &offset, &kinds)) {
+            PyObject *copy = PyDict_Copy(kinds);
+            if (copy == NULL || PyDict_SetItem(res, offset, copy) < 0) {
+                Py_XDECREF(copy);
+                Py_CLEAR(res);
+                break;
+            }
+            Py_DECREF(copy);
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+    return res;
+}
+
 /******************
  * PyCode_Type
  ******************/
@@ -1915,6 +2000,7 @@ code_dealloc(PyCodeObject *co)
         Py_XDECREF(co->_co_cached->_co_cellvars);
         Py_XDECREF(co->_co_cached->_co_freevars);
         Py_XDECREF(co->_co_cached->_co_varnames);
+        Py_XDECREF(co->_co_cached->_co_spec_failures);
         PyMem_Free(co->_co_cached);
     }
     if (co->co_weakreflist != NULL) {
@@ -2749,6 +2835,10 @@ _PyCode_Fini(PyInterpreterState *interp)
     }
     _PyIndexPool_Fini(&interp->tlbc_indices);
 #endif
+    struct _Py_spec_failure_state *failures = &interp->code_state.spec_failures;
+    PyMem_RawFree(failures->counts);
+    failures->counts = NULL;
+    failures->sample_rate = 0;
 }
 
 #ifdef Py_GIL_DISABLED
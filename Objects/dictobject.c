@@ -283,6 +283,18 @@ load_keys_nentries(PyDictObject *mp)
 #define STORE_KEYS_NENTRIES(keys, nentries) FT_ATOMIC_STORE_SSIZE_RELAXED(keys->dk_nentries, nentries)
 #define STORE_USED(mp, used) FT_ATOMIC_STORE_SSIZE_RELAXED(mp->ma_used, used)
 
+/* Dicts with a combined table start out untracked by the GC; they are
+   tracked as soon as a key or value that may be tracked is inserted. */
+#define MAINTAIN_TRACKING(mp, key, value) \
+    do { \
+        if (!_PyObject_GC_IS_TRACKED(mp)) { \
+            if (_PyObject_GC_MAY_BE_TRACKED(key) || \
+                _PyObject_GC_MAY_BE_TRACKED(value)) { \
+                _PyObject_GC_TRACK(mp); \
+            } \
+        } \
+    } while (0)
+
 #define PERTURB_SHIFT 5
 
 /*
@@ -886,7 +898,6 @@ new_dict(PyInterpreterState *interp,
     mp->ma_used = used;
     mp->_ma_watcher_tag = 0;
     ASSERT_CONSISTENT(mp);
-    _PyObject_GC_TRACK(mp);
     return (PyObject *)mp;
 }
 
@@ -902,7 +913,11 @@ new_dict_with_shared_keys(PyInterpreterState *interp, PyDictKeysObject *keys)
     for (size_t i = 0; i < size; i++) {
         values->values[i] = NULL;
     }
-    return new_dict(interp, keys, values, 0, 1);
+    PyObject *mp = new_dict(interp, keys, values, 0, 1);
+    if (mp != NULL) {
+        _PyObject_GC_TRACK(mp);
+    }
+    return mp;
 }
 
 
@@ -1783,6 +1798,7 @@ insertdict(PyInterpreterState *interp, PyDictObject *mp,
     PyObject *old_value;
 
     ASSERT_DICT_LOCKED(mp);
+    MAINTAIN_TRACKING(mp, key, value);
 
     if (DK_IS_UNICODE(mp->ma_keys) && !PyUnicode_CheckExact(key)) {
         if (insertion_resize(interp, mp, 0) < 0)
@@ -1853,6 +1869,7 @@ insert_to_emptydict(PyInterpreterState *interp, PyDictObject *mp,
 {
     assert(mp->ma_keys == Py_EMPTY_KEYS);
     ASSERT_DICT_LOCKED(mp);
+    MAINTAIN_TRACKING(mp, key, value);
 
     int unicode = PyUnicode_CheckExact(key);
     PyDictKeysObject *newkeys = new_keys_object(
@@ -3334,41 +3351,59 @@ dict_length(PyObject *self)
     return FT_ATOMIC_LOAD_SSIZE_RELAXED(((PyDictObject *)self)->ma_used);
 }
 
-static PyObject *
-dict_subscript(PyObject *self, PyObject *key)
+int
+_PyDict_GetOptionalSubscript(PyObject *self, PyObject *key, PyObject **result)
 {
     PyDictObject *mp = (PyDictObject *)self;
     Py_ssize_t ix;
     Py_hash_t hash;
     PyObject *value;
 
+    *result = NULL;
     hash = _PyObject_HashFast(key);
     if (hash == -1) {
-        return NULL;
+        return -1;
     }
     ix = _Py_dict_lookup_threadsafe(mp, key, hash, &value);
     if (ix == DKIX_ERROR)
-        return NULL;
+        return -1;
     if (ix == DKIX_EMPTY || value == NULL) {
         if (!PyDict_CheckExact(mp)) {
             /* Look up __missing__ method if we're a subclass. */
-            PyObject *missing, *res;
+            PyObject *missing;
             missing = _PyObject_LookupSpecial(
                     (PyObject *)mp, &_Py_ID(__missing__));
             if (missing != NULL) {
-                res = PyObject_CallOneArg(missing, key);
+                *result = PyObject_CallOneArg(missing, key);
                 Py_DECREF(missing);
-                return res;
+                return *result != NULL ? 1 : -1;
             }
             else if (PyErr_Occurred())
-                return NULL;
+                return -1;
         }
+        return 0;
+    }
+    *result = value;
+    return 1;
+}
+
+static PyObject *
+dict_subscript(PyObject *self, PyObject *key)
+{
+    PyObject *value;
+    if (_PyDict_GetOptionalSubscript(self, key, &value) == 0) {
         _PyErr_SetKeyError(key);
-        return NULL;
     }
     return value;
 }
 
+int
+_PyDict_HasDefaultSubscript(PyTypeObject *type)
+{
+    return type->tp_as_mapping != NULL &&
+           type->tp_as_mapping->mp_subscript == dict_subscript;
+}
+
 static int
 dict_ass_sub(PyObject *mp, PyObject *v, PyObject *w)
 {
@@ -4043,6 +4078,10 @@ copy_lock_held(PyObject *o)
 
         new->ma_used = mp->ma_used;
         ASSERT_CONSISTENT(new);
+        if (_PyObject_GC_IS_TRACKED(mp)) {
+            /* Maintain tracking. */
+            _PyObject_GC_TRACK(new);
+        }
         return (PyObject *)new;
     }
 
@@ -4320,6 +4359,7 @@ dict_setdefault_ref_lock_held(PyObject *d, PyObject *key, PyObject *default_valu
     if (ix == DKIX_EMPTY) {
         assert(!_PyDict_HasSplitTable(mp));
         value = default_value;
+        MAINTAIN_TRACKING(mp, key, value);
 
         if (insert_combined_dict(interp, mp, hash, Py_NewRef(key), Py_NewRef(value)) < 0) {
             Py_DECREF(key);
@@ -4777,7 +4817,13 @@ dict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     d->ma_keys = Py_EMPTY_KEYS;
     d->ma_values = NULL;
     ASSERT_CONSISTENT(d);
-    if (!_PyObject_GC_IS_TRACKED(d)) {
+    if (type == &PyDict_Type) {
+        /* The object has been implicitly tracked by tp_alloc. */
+        if (_PyObject_GC_IS_TRACKED(d)) {
+            _PyObject_GC_UNTRACK(d);
+        }
+    }
+    else if (!_PyObject_GC_IS_TRACKED(d)) {
         _PyObject_GC_TRACK(d);
     }
     return self;
@@ -5594,6 +5640,21 @@ dictiter_iternextitem(PyObject *self)
     return NULL;
 }
 
+int
+_PyDictIter_NextItem(PyObject *self, PyObject **key, PyObject **value)
+{
+    assert(Py_IS_TYPE(self, &PyDictIterItem_Type));
+    PyDictObject *d = ((dictiterobject *)self)->di_dict;
+    if (d == NULL) {
+        return 0;
+    }
+#ifdef Py_GIL_DISABLED
+    return dictiter_iternext_threadsafe(d, self, key, value) == 0;
+#else
+    return dictiter_iternextitem_lock_held(d, self, key, value) == 0;
+#endif
+}
+
 PyTypeObject PyDictIterItem_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     "dict_itemiterator",                        /* tp_name */
@@ -6723,6 +6784,9 @@ make_dict_from_instance_attributes(PyInterpreterState *interp,
         }
     }
     PyDictObject *res = (PyDictObject *)new_dict(interp, keys, values, used, 0);
+    if (res != NULL) {
+        _PyObject_GC_TRACK(res);
+    }
     return res;
 }
 
@@ -6830,6 +6894,16 @@ store_instance_attr_lock_held(PyObject *obj, PyDictValues *values,
 
     if (ix == DKIX_EMPTY) {
         int res;
+        if (value == NULL && PyUnicode_CheckExact(name)) {
+            // The name isn't in the shared keys, and any dict shares the
+            // values, so it cannot hold the name either: don't materialize
+            // one (or a KeyError) just to report that. A str subclass may
+            // still compare equal to a key, so it takes the slow path.
+            PyErr_Format(PyExc_AttributeError,
+                         "'%.100s' object has no attribute '%U'",
+                         Py_TYPE(obj)->tp_name, name);
+            return -1;
+        }
         if (dict == NULL) {
             // Make the dict but don't publish it in the object
             // so that no one else will see it.
@@ -269,6 +269,37 @@ enum_next(enumobject *en)
     return result;
 }
 
+int
+_PyEnum_NextPair(PyObject *self, PyObject **index, PyObject **item)
+{
+    enumobject *en = (enumobject *)self;
+    assert(Py_IS_TYPE(self, &PyEnum_Type));
+    if (en->en_index == PY_SSIZE_T_MAX) {
+        PyObject *result = enum_next(en);
+        if (result == NULL) {
+            return 0;
+        }
+        *index = Py_NewRef(PyTuple_GET_ITEM(result, 0));
+        *item = Py_NewRef(PyTuple_GET_ITEM(result, 1));
+        Py_DECREF(result);
+        return 1;
+    }
+    PyObject *it = en->en_sit;
+    PyObject *next_item = (*Py_TYPE(it)->tp_iternext)(it);
+    if (next_item == NULL) {
+        return 0;
+    }
+    PyObject *next_index = PyLong_FromSsize_t(en->en_index);
+    if (next_index == NULL) {
+        Py_DECREF(next_item);
+        return 0;
+    }
+    en->en_index++;
+    *index = next_index;
+    *item = next_item;
+    return 1;
+}
+
 static PyObject *
 enum_reduce(enumobject *en, PyObject *Py_UNUSED(ignored))
 {
@@ -1269,22 +1269,15 @@ descriptor_set_wrapped_attribute(PyObject *oobj, PyObject *name, PyObject *value
         return -1;
     }
     if (value == NULL) {
-        if (PyDict_DelItem(dict, name) < 0) {
-            if (PyErr_ExceptionMatches(PyExc_KeyError)) {
-                PyErr_Clear();
-                PyErr_Format(PyExc_AttributeError,
-                             "'%.200s' object has no attribute '%U'",
-                             type_name, name);
-                Py_DECREF(dict);
-                return -1;
-            }
-            else {
-                Py_DECREF(dict);
-                return -1;
-            }
-        }
+        int rc = PyDict_Pop(dict, name, NULL);
         Py_DECREF(dict);
-        return 0;
+        if (rc == 0) {
+            PyErr_Format(PyExc_AttributeError,
+                         "'%.200s' object has no attribute '%U'",
+                         type_name, name);
+            return -1;
+        }
+        return rc < 0 ? -1 : 0;
     }
     else {
         Py_DECREF(dict);
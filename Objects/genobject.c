@@ -44,6 +44,58 @@ _PyGen_GetCode(PyGenObject *gen) {
     return _PyFrame_GetCode(&gen->gi_iframe);
 }
 
+/* Both return a borrowed reference */
+static inline PyObject *
+gen_name(PyGenObject *gen)
+{
+    if (gen->gi_names != NULL) {
+        return PyTuple_GET_ITEM(gen->gi_names, 0);
+    }
+    return _PyGen_GetCode(gen)->co_name;
+}
+
+static inline PyObject *
+gen_qualname(PyGenObject *gen)
+{
+    if (gen->gi_names != NULL) {
+        return PyTuple_GET_ITEM(gen->gi_names, 1);
+    }
+    return _PyGen_GetCode(gen)->co_qualname;
+}
+
+PyObject *
+_PyGen_GetQualname(PyGenObject *gen)
+{
+    return gen_qualname(gen);
+}
+
+/* Only names differing from those of the code object need to be stored,
+   which keeps the common generator free of two references. */
+static int
+make_names(PyCodeObject *code, PyObject *name, PyObject *qualname,
+           PyObject **names)
+{
+    *names = NULL;
+    if (name != code->co_name || qualname != code->co_qualname) {
+        *names = PyTuple_Pack(2, name, qualname);
+        if (*names == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+gen_set_names(PyGenObject *gen, PyObject *name, PyObject *qualname)
+{
+    PyObject *names;
+    if (make_names(_PyGen_GetCode(gen), name, qualname, &names) < 0) {
+        return -1;
+    }
+    Py_XSETREF(gen->gi_names, names);
+    return 0;
+}
+
 PyCodeObject *
 PyGen_GetCode(PyGenObject *gen) {
     assert(PyGen_Check(gen));
@@ -56,8 +108,7 @@ static int
 gen_traverse(PyObject *self, visitproc visit, void *arg)
 {
     PyGenObject *gen = _PyGen_CAST(self);
-    Py_VISIT(gen->gi_name);
-    Py_VISIT(gen->gi_qualname);
+    Py_VISIT(gen->gi_names);
     if (gen->gi_frame_state != FRAME_CLEARED) {
         _PyInterpreterFrame *frame = &gen->gi_iframe;
         assert(frame->frame_obj == NULL ||
@@ -168,8 +219,7 @@ gen_dealloc(PyObject *self)
     }
     assert(gen->gi_exc_state.exc_value == NULL);
     PyStackRef_CLEAR(gen->gi_iframe.f_executable);
-    Py_CLEAR(gen->gi_name);
-    Py_CLEAR(gen->gi_qualname);
+    Py_CLEAR(gen->gi_names);
 
     PyObject_GC_Del(gen);
 }
@@ -692,14 +742,14 @@ gen_repr(PyObject *self)
 {
     PyGenObject *gen = _PyGen_CAST(self);
     return PyUnicode_FromFormat("<generator object %S at %p>",
-                                gen->gi_qualname, gen);
+                                gen_qualname(gen), gen);
 }
 
 static PyObject *
 gen_get_name(PyObject *self, void *Py_UNUSED(ignored))
 {
     PyGenObject *op = _PyGen_CAST(self);
-    return Py_NewRef(op->gi_name);
+    return Py_NewRef(gen_name(op));
 }
 
 static int
@@ -713,15 +763,14 @@ gen_set_name(PyObject *self, PyObject *value, void *Py_UNUSED(ignored))
                         "__name__ must be set to a string object");
         return -1;
     }
-    Py_XSETREF(op->gi_name, Py_NewRef(value));
-    return 0;
+    return gen_set_names(op, value, gen_qualname(op));
 }
 
 static PyObject *
 gen_get_qualname(PyObject *self, void *Py_UNUSED(ignored))
 {
     PyGenObject *op = _PyGen_CAST(self);
-    return Py_NewRef(op->gi_qualname);
+    return Py_NewRef(gen_qualname(op));
 }
 
 static int
@@ -735,8 +784,7 @@ gen_set_qualname(PyObject *self, PyObject *value, void *Py_UNUSED(ignored))
                         "__qualname__ must be set to a string object");
         return -1;
     }
-    Py_XSETREF(op->gi_qualname, Py_NewRef(value));
-    return 0;
+    return gen_set_names(op, gen_name(op), value);
 }
 
 static PyObject *
@@ -907,19 +955,23 @@ static PyObject *
 make_gen(PyTypeObject *type, PyFunctionObject *func)
 {
     PyCodeObject *code = (PyCodeObject *)func->func_code;
+    PyObject *names;
+    assert(func->func_name != NULL);
+    assert(func->func_qualname != NULL);
+    if (make_names(code, func->func_name, func->func_qualname, &names) < 0) {
+        return NULL;
+    }
     int slots = _PyFrame_NumSlotsForCodeObject(code);
     PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, slots);
     if (gen == NULL) {
+        Py_XDECREF(names);
         return NULL;
     }
     gen->gi_frame_state = FRAME_CLEARED;
     gen->gi_weakreflist = NULL;
     gen->gi_exc_state.exc_value = NULL;
     gen->gi_exc_state.previous_item = NULL;
-    assert(func->func_name != NULL);
-    gen->gi_name = Py_NewRef(func->func_name);
-    assert(func->func_qualname != NULL);
-    gen->gi_qualname = Py_NewRef(func->func_qualname);
+    gen->gi_names = names;
     _PyObject_GC_TRACK(gen);
     return (PyObject *)gen;
 }
@@ -979,9 +1031,18 @@ gen_new_with_qualname(PyTypeObject *type, PyFrameObject *f,
                       PyObject *name, PyObject *qualname)
 {
     PyCodeObject *code = _PyFrame_GetCode(f->f_frame);
+    PyObject *names;
+    if (make_names(code,
+                   name != NULL ? name : code->co_name,
+                   qualname != NULL ? qualname : code->co_qualname,
+                   &names) < 0) {
+        Py_DECREF(f);
+        return NULL;
+    }
     int size = code->co_nlocalsplus + code->co_stacksize;
     PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, size);
     if (gen == NULL) {
+        Py_XDECREF(names);
         Py_DECREF(f);
         return NULL;
     }
@@ -999,14 +1060,7 @@ gen_new_with_qualname(PyTypeObject *type, PyFrameObject *f,
     gen->gi_weakreflist = NULL;
     gen->gi_exc_state.exc_value = NULL;
     gen->gi_exc_state.previous_item = NULL;
-    if (name != NULL)
-        gen->gi_name = Py_NewRef(name);
-    else
-        gen->gi_name = Py_NewRef(_PyGen_GetCode(gen)->co_name);
-    if (qualname != NULL)
-        gen->gi_qualname = Py_NewRef(qualname);
-    else
-        gen->gi_qualname = Py_NewRef(_PyGen_GetCode(gen)->co_qualname);
+    gen->gi_names = names;
     _PyObject_GC_TRACK(gen);
     return (PyObject *)gen;
 }
@@ -1101,7 +1155,7 @@ coro_repr(PyObject *self)
 {
     PyCoroObject *coro = _PyCoroObject_CAST(self);
     return PyUnicode_FromFormat("<coroutine object %S at %p>",
-                                coro->cr_qualname, coro);
+                                gen_qualname(_PyGen_CAST(self)), coro);
 }
 
 static PyObject *
@@ -1479,7 +1533,7 @@ async_gen_repr(PyObject *self)
 {
     PyAsyncGenObject *o = _PyAsyncGenObject_CAST(self);
     return PyUnicode_FromFormat("<async_generator object %S at %p>",
-                                o->ag_qualname, o);
+                                gen_qualname(_PyGen_CAST(self)), o);
 }
 
 
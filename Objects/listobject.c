@@ -75,8 +75,10 @@ ensure_shared_on_resize(PyListObject *self)
 #ifdef Py_GIL_DISABLED
     // We can't use _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED here because
     // the `CALL_LIST_APPEND` bytecode handler may lock the list without
-    // a critical section.
-    assert(Py_REFCNT(self) == 1 || PyMutex_IsLocked(&_PyObject_CAST(self)->ob_mutex));
+    // a critical section. A list that is still being built may have been
+    // made immortal by gc.immortalize().
+    assert(Py_REFCNT(self) == 1 || _Py_IsImmortal(self) ||
+           PyMutex_IsLocked(&_PyObject_CAST(self)->ob_mutex));
 
     // Ensure that the list array is freed using QSBR if we are not the
     // owning thread.
@@ -3914,6 +3914,93 @@ long_sub_method(PyObject *a, PyObject *b)
     return (PyObject*)long_sub((PyLongObject*)a, (PyLongObject*)b);
 }
 
+/* Helpers for the specialized int instructions: compute the result of
+   combining two exact ints and consume both operands.  When both operands
+   are compact and the result is a medium int, a uniquely referenced
+   operand is reused for the result, so that chained arithmetic on
+   temporaries does not allocate (see _PyFloat_FromDouble_ConsumeInputs). */
+
+#ifdef Py_GIL_DISABLED
+
+static PyObject *
+compact_result_consume_inputs(_PyStackRef left, _PyStackRef right,
+                              stwodigits value)
+{
+    PyObject *res = (PyObject *)_PyLong_FromSTwoDigits(value);
+    PyStackRef_CLOSE(left);
+    PyStackRef_CLOSE(right);
+    return res;
+}
+
+#else // Py_GIL_DISABLED
+
+static PyObject *
+compact_result_consume_inputs(_PyStackRef left, _PyStackRef right,
+                              stwodigits value)
+{
+    PyObject *left_o = PyStackRef_AsPyObjectSteal(left);
+    PyObject *right_o = PyStackRef_AsPyObjectSteal(right);
+    if (is_medium_int(value) && !IS_SMALL_INT(value)) {
+        /* Small ints are immortal, so a uniquely referenced compact int is
+           never one of them and can be modified in place. */
+        PyLongObject *res = NULL;
+        if (Py_REFCNT(left_o) == 1) {
+            res = (PyLongObject *)left_o;
+            _Py_DECREF_SPECIALIZED(right_o, _PyLong_ExactDealloc);
+        }
+        else if (Py_REFCNT(right_o) == 1) {
+            res = (PyLongObject *)right_o;
+            _Py_DECREF_NO_DEALLOC(left_o);
+        }
+        if (res != NULL) {
+            assert(_PyLong_IsCompact(res));
+            digit abs_value = (digit)(value < 0 ? -value : value);
+            _PyLong_SetSignAndDigitCount(res, value < 0 ? -1 : 1, 1);
+            res->long_value.ob_digit[0] = abs_value;
+            return (PyObject *)res;
+        }
+    }
+    PyObject *res = (PyObject *)_PyLong_FromSTwoDigits(value);
+    _Py_DECREF_SPECIALIZED(left_o, _PyLong_ExactDealloc);
+    _Py_DECREF_SPECIALIZED(right_o, _PyLong_ExactDealloc);
+    return res;
+}
+
+#endif // Py_GIL_DISABLED
+
+static PyObject *
+long_result_consume_inputs(_PyStackRef left, _PyStackRef right,
+                           PyLongObject *res)
+{
+    PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+    PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+    return (PyObject *)res;
+}
+
+PyObject *
+_PyLong_Add_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    PyLongObject *a = (PyLongObject *)PyStackRef_AsPyObjectBorrow(left);
+    PyLongObject *b = (PyLongObject *)PyStackRef_AsPyObjectBorrow(right);
+    if (_PyLong_BothAreCompact(a, b)) {
+        return compact_result_consume_inputs(left, right,
+                                             medium_value(a) + medium_value(b));
+    }
+    return long_result_consume_inputs(left, right, long_add(a, b));
+}
+
+PyObject *
+_PyLong_Subtract_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    PyLongObject *a = (PyLongObject *)PyStackRef_AsPyObjectBorrow(left);
+    PyLongObject *b = (PyLongObject *)PyStackRef_AsPyObjectBorrow(right);
+    if (_PyLong_BothAreCompact(a, b)) {
+        return compact_result_consume_inputs(left, right,
+                                             medium_value(a) - medium_value(b));
+    }
+    return long_result_consume_inputs(left, right, long_sub(a, b));
+}
+
 
 /* Grade school multiplication, ignoring the signs.
  * Returns the absolute value of the product, or NULL if error.
@@ -4361,6 +4448,18 @@ long_mul_method(PyObject *a, PyObject *b)
     return (PyObject*)long_mul((PyLongObject*)a, (PyLongObject*)b);
 }
 
+PyObject *
+_PyLong_Multiply_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    PyLongObject *a = (PyLongObject *)PyStackRef_AsPyObjectBorrow(left);
+    PyLongObject *b = (PyLongObject *)PyStackRef_AsPyObjectBorrow(right);
+    if (_PyLong_BothAreCompact(a, b)) {
+        return compact_result_consume_inputs(left, right,
+                                             medium_value(a) * medium_value(b));
+    }
+    return long_result_consume_inputs(left, right, long_mul(a, b));
+}
+
 /* Fast modulo division for single-digit longs. */
 static PyObject *
 fast_mod(PyLongObject *a, PyLongObject *b)
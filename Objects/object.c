@@ -81,6 +81,12 @@ static inline void
 reftotal_add(PyThreadState *tstate, Py_ssize_t n)
 {
 #ifdef Py_GIL_DISABLED
+    if (tstate == NULL) {
+        // Threads without a thread state, like the garbage collector's
+        // marking threads, may incref in tp_traverse.
+        _Py_atomic_add_ssize(&_Py_RefTotal, n);
+        return;
+    }
     _PyThreadStateImpl *tstate_impl = (_PyThreadStateImpl *)tstate;
     // relaxed store to avoid data race with read in get_reftotal()
     Py_ssize_t reftotal = tstate_impl->reftotal + n;
@@ -1848,17 +1854,33 @@ _PyObject_GenericSetAttrWithDict(PyObject *obj, PyObject *name,
     }
     else {
         Py_INCREF(dict);
-        if (value == NULL)
-            res = PyDict_DelItem(dict, name);
+        if (value == NULL) {
+            /* Report a missing attribute without creating a KeyError. */
+            res = PyDict_Pop(dict, name, NULL);
+            if (res == 0) {
+                PyErr_Format(PyExc_AttributeError,
+                             "'%.100s' object has no attribute '%U'",
+                             tp->tp_name, name);
+                _PyObject_SetAttributeErrorContext(obj, name);
+                res = -1;
+            }
+            else if (res > 0) {
+                res = 0;
+            }
+        }
         else
             res = PyDict_SetItem(dict, name, value);
         Py_DECREF(dict);
     }
   error_check:
-    if (res < 0 && PyErr_ExceptionMatches(PyExc_KeyError)) {
-        PyErr_Format(PyExc_AttributeError,
-                        "'%.100s' object has no attribute '%U'",
-                        tp->tp_name, name);
+    if (res < 0) {
+        if (PyErr_ExceptionMatches(PyExc_KeyError)) {
+            PyErr_Format(PyExc_AttributeError,
+                            "'%.100s' object has no attribute '%U'",
+                            tp->tp_name, name);
+        }
+        // Also covers the AttributeError raised directly for a missing
+        // inline value.
         _PyObject_SetAttributeErrorContext(obj, name);
     }
   done:
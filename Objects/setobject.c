@@ -35,6 +35,7 @@
 #include "pycore_ceval.h"               // _PyEval_GetBuiltin()
 #include "pycore_critical_section.h"    // Py_BEGIN_CRITICAL_SECTION, Py_END_CRITICAL_SECTION
 #include "pycore_dict.h"                // _PyDict_Contains_KnownHash()
+#include "pycore_gc.h"                  // _PyObject_GC_MAY_BE_TRACKED()
 #include "pycore_modsupport.h"          // _PyArg_NoKwnames()
 #include "pycore_object.h"              // _PyObject_GC_UNTRACK()
 #include "pycore_pyatomic_ft_wrappers.h"  // FT_ATOMIC_LOAD_SSIZE_RELAXED()
@@ -121,6 +122,16 @@ set_lookkey(PySetObject *so, PyObject *key, Py_hash_t hash)
 
 static int set_table_resize(PySetObject *, Py_ssize_t);
 
+/* Exact frozensets start out untracked by the GC: they are tracked once a
+   key that could be part of a reference cycle is added to them. */
+static inline void
+set_maintain_tracking(PySetObject *so, PyObject *key)
+{
+    if (!_PyObject_GC_IS_TRACKED(so) && _PyObject_GC_MAY_BE_TRACKED(key)) {
+        _PyObject_GC_TRACK(so);
+    }
+}
+
 static int
 set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
 {
@@ -189,6 +200,7 @@ set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
     FT_ATOMIC_STORE_SSIZE_RELAXED(so->used, so->used + 1);
     freeslot->key = key;
     freeslot->hash = hash;
+    set_maintain_tracking(so, key);
     return 0;
 
   found_unused:
@@ -196,6 +208,7 @@ set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
     FT_ATOMIC_STORE_SSIZE_RELAXED(so->used, so->used + 1);
     entry->key = key;
     entry->hash = hash;
+    set_maintain_tracking(so, key);
     if ((size_t)so->fill*5 < mask*3)
         return 0;
     return set_table_resize(so, so->used>50000 ? so->used*2 : so->used*4);
@@ -617,6 +630,7 @@ set_merge_lock_held(PySetObject *so, PyObject *otherset)
                 assert(so_entry->key == NULL);
                 so_entry->key = Py_NewRef(key);
                 so_entry->hash = other_entry->hash;
+                set_maintain_tracking(so, key);
             }
         }
         so->fill = other->fill;
@@ -635,6 +649,7 @@ set_merge_lock_held(PySetObject *so, PyObject *otherset)
             if (key != NULL && key != dummy) {
                 set_insert_clean(newtable, newmask, Py_NewRef(key),
                                  other_entry->hash);
+                set_maintain_tracking(so, key);
             }
         }
         return 0;
@@ -1097,6 +1112,9 @@ make_new_set(PyTypeObject *type, PyObject *iterable)
     so->hash = -1;
     so->finger = 0;
     so->weakreflist = NULL;
+    if (type == &PyFrozenSet_Type) {
+        _PyObject_GC_UNTRACK(so);
+    }
 
     if (iterable != NULL) {
         if (set_update_local(so, iterable)) {
@@ -7,8 +7,10 @@
 #include "pycore_freelist.h"      // _Py_FREELIST_PUSH(), _Py_FREELIST_POP()
 #include "pycore_gc.h"            // _PyObject_GC_IS_TRACKED()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
+#include "pycore_long.h"          // _PyLong_IsCompact()
 #include "pycore_modsupport.h"    // _PyArg_NoKwnames()
 #include "pycore_object.h"        // _PyObject_GC_TRACK(), _Py_FatalRefcountError(), _PyDebugAllocatorStats()
+#include "pycore_unicodeobject.h" // _PyUnicode_Equal()
 
 /*[clinic input]
 class tuple "PyTupleObject *" "&PyTuple_Type"
@@ -25,7 +27,7 @@ static inline int maybe_freelist_push(PyTupleObject *);
    steps must be done:
 
    - Initialize its items.
-   - Call _PyObject_GC_TRACK() on it.
+   - Call _PyObject_GC_TRACK() or tuple_gc_track() on it.
 
    Because the empty tuple is always reused and it's already tracked by GC,
    this function must not be called with size == 0 (unless from PyTuple_New()
@@ -54,6 +56,20 @@ tuple_alloc(Py_ssize_t size)
     return PyObject_GC_NewVar(PyTupleObject, &PyTuple_Type, size);
 }
 
+/* Track a tuple whose items have all been set, unless none of the first n
+   items can be part of a reference cycle.  A tuple of atomic objects can
+   never become part of one, so there is no need for the GC to scan it. */
+static inline void
+tuple_gc_track(PyTupleObject *op, Py_ssize_t n)
+{
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (_PyObject_GC_MAY_BE_TRACKED(op->ob_item[i])) {
+            _PyObject_GC_TRACK(op);
+            return;
+        }
+    }
+}
+
 // The empty tuple singleton is not tracked by the GC.
 // It does not contain any Python object.
 // Note that tuple subclasses have their own empty instances.
@@ -173,7 +189,7 @@ PyTuple_Pack(Py_ssize_t n, ...)
         items[i] = Py_NewRef(o);
     }
     va_end(vargs);
-    _PyObject_GC_TRACK(result);
+    tuple_gc_track(result, n);
     return (PyObject *)result;
 }
 
@@ -348,17 +364,58 @@ tuple_length(PyObject *self)
     return Py_SIZE(a);
 }
 
-static int
-tuple_contains(PyObject *self, PyObject *el)
+/* PyObject_RichCompareBool(v, w, Py_EQ) for the common case of items that
+ * are exact strs, floats or compact ints of the same type.
+ * Returns -2 if the items have to go through the generic comparison.
+ */
+static inline int
+items_equal(PyObject *v, PyObject *w)
+{
+    if (v == w) {
+        return 1;
+    }
+    PyTypeObject *tp = Py_TYPE(v);
+    if (tp != Py_TYPE(w)) {
+        return -2;
+    }
+    if (tp == &PyUnicode_Type) {
+        return _PyUnicode_Equal(v, w);
+    }
+    if (tp == &PyLong_Type) {
+        if (_PyLong_IsCompact((PyLongObject *)v) &&
+            _PyLong_IsCompact((PyLongObject *)w))
+        {
+            return _PyLong_CompactValue((PyLongObject *)v) ==
+                   _PyLong_CompactValue((PyLongObject *)w);
+        }
+        return -2;
+    }
+    if (tp == &PyFloat_Type) {
+        return PyFloat_AS_DOUBLE(v) == PyFloat_AS_DOUBLE(w);
+    }
+    return -2;
+}
+
+int
+_PyTuple_Contains(PyObject *self, PyObject *el)
 {
     PyTupleObject *a = _PyTuple_CAST(self);
     int cmp = 0;
     for (Py_ssize_t i = 0; cmp == 0 && i < Py_SIZE(a); ++i) {
-        cmp = PyObject_RichCompareBool(PyTuple_GET_ITEM(a, i), el, Py_EQ);
+        cmp = items_equal(PyTuple_GET_ITEM(a, i), el);
+        if (cmp == -2) {
+            cmp = PyObject_RichCompareBool(PyTuple_GET_ITEM(a, i), el, Py_EQ);
+        }
     }
     return cmp;
 }
 
+static int
+tuple_contains(PyObject *self, PyObject *el)
+{
+    return _PyTuple_Contains(self, el);
+}
+
 static PyObject *
 tuple_item(PyObject *op, Py_ssize_t i)
 {
@@ -386,7 +443,7 @@ _PyTuple_FromArray(PyObject *const *src, Py_ssize_t n)
         PyObject *item = src[i];
         dst[i] = Py_NewRef(item);
     }
-    _PyObject_GC_TRACK(tuple);
+    tuple_gc_track(tuple, n);
     return (PyObject *)tuple;
 }
 
@@ -407,7 +464,7 @@ _PyTuple_FromStackRefSteal(const _PyStackRef *src, Py_ssize_t n)
     for (Py_ssize_t i = 0; i < n; i++) {
         dst[i] = PyStackRef_AsPyObjectSteal(src[i]);
     }
-    _PyObject_GC_TRACK(tuple);
+    tuple_gc_track(tuple, n);
     return (PyObject *)tuple;
 }
 
@@ -429,7 +486,7 @@ _PyTuple_FromArraySteal(PyObject *const *src, Py_ssize_t n)
         PyObject *item = src[i];
         dst[i] = item;
     }
-    _PyObject_GC_TRACK(tuple);
+    tuple_gc_track(tuple, n);
     return (PyObject *)tuple;
 }
 
@@ -502,7 +559,7 @@ tuple_concat(PyObject *aa, PyObject *bb)
         dest[i] = Py_NewRef(v);
     }
 
-    _PyObject_GC_TRACK(np);
+    tuple_gc_track(np, size);
     return (PyObject *)np;
 }
 
@@ -551,7 +608,7 @@ tuple_repeat(PyObject *self, Py_ssize_t n)
         _Py_memory_repeat((char *)np->ob_item, sizeof(PyObject *)*output_size,
                           sizeof(PyObject *)*input_size);
     }
-    _PyObject_GC_TRACK(np);
+    tuple_gc_track(np, input_size);
     return (PyObject *) np;
 }
 
@@ -633,8 +690,8 @@ tuple_traverse(PyObject *self, visitproc visit, void *arg)
     return 0;
 }
 
-static PyObject *
-tuple_richcompare(PyObject *v, PyObject *w, int op)
+PyObject *
+_PyTuple_RichCompare(PyObject *v, PyObject *w, int op)
 {
     PyTupleObject *vt, *wt;
     Py_ssize_t i;
@@ -661,8 +718,10 @@ tuple_richcompare(PyObject *v, PyObject *w, int op)
      * vlen and wlen across the comparison calls.
      */
     for (i = 0; i < vlen && i < wlen; i++) {
-        int k = PyObject_RichCompareBool(vt->ob_item[i],
-                                         wt->ob_item[i], Py_EQ);
+        int k = items_equal(vt->ob_item[i], wt->ob_item[i]);
+        if (k == -2) {
+            k = PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_EQ);
+        }
         if (k < 0)
             return NULL;
         if (!k)
@@ -827,7 +886,7 @@ tuple_subscript(PyObject *op, PyObject* item)
                 dest[i] = it;
             }
 
-            _PyObject_GC_TRACK(result);
+            tuple_gc_track(result, slicelength);
             return (PyObject *)result;
         }
     }
@@ -892,7 +951,7 @@ PyTypeObject PyTuple_Type = {
     tuple_new__doc__,                           /* tp_doc */
     tuple_traverse,                             /* tp_traverse */
     0,                                          /* tp_clear */
-    tuple_richcompare,                          /* tp_richcompare */
+    _PyTuple_RichCompare,                       /* tp_richcompare */
     0,                                          /* tp_weaklistoffset */
     tuple_iter,                                 /* tp_iter */
     0,                                          /* tp_iternext */
@@ -13,6 +13,7 @@
 #include "pycore_moduleobject.h"  // _PyModule_GetDef()
 #include "pycore_object.h"        // _PyType_HasFeature()
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_optimizer.h"     // _Py_Executors_InvalidateDependency()
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_symtable.h"      // _Py_Mangle()
@@ -2355,6 +2356,15 @@ subtype_traverse(PyObject *self, visitproc visit, void *arg)
     return 0;
 }
 
+PyTypeObject *
+_PyType_GetTraverseBase(PyTypeObject *type)
+{
+    while (type->tp_traverse == subtype_traverse) {
+        type = type->tp_base;
+    }
+    return type;
+}
+
 static void
 clear_slots(PyTypeObject *type, PyObject *self)
 {
@@ -6122,6 +6132,7 @@ type_dealloc(PyObject *self)
     _PyObject_ASSERT((PyObject *)type, type->tp_flags & Py_TPFLAGS_HEAPTYPE);
 
     _PyObject_GC_UNTRACK(type);
+    _PyGC_RemoveTypeStats(_PyInterpreterState_GET(), type);
     type_dealloc_common(type);
 
     // PyObject_ClearWeakRefs() raises an exception if Py_REFCNT() != 0
@@ -6920,6 +6931,9 @@ object_set_class(PyObject *self, PyObject *value, void *closure)
     _PyEval_StartTheWorld(interp);
 #endif
     if (res == 0) {
+        /* Executors may rely on the type of an object held in a local
+         * variable not changing, not just on the type itself not changing */
+        _Py_Executors_InvalidateDependency(_PyInterpreterState_GET(), oldto, 1);
         if (oldto->tp_flags & Py_TPFLAGS_HEAPTYPE) {
             Py_DECREF(oldto);
         }
@@ -10402,6 +10402,74 @@ _PyUnicode_JoinArray(PyObject *separator, PyObject *const *items, Py_ssize_t seq
     return NULL;
 }
 
+/* Concatenate items like _PyUnicode_JoinArray() with an empty separator,
+   but first format the items whose bit is set in format_mask, as
+   format(item, '') would. The other items are already formatted, so they
+   are strs (possibly of a subclass) and are written as they are. Exact ints
+   and floats are written straight into the result, which is sized from the
+   items up front. */
+PyObject *
+_PyUnicode_JoinFormatted(PyObject *const *items, Py_ssize_t seqlen,
+                         uint64_t format_mask)
+{
+    assert(seqlen <= 64);
+    Py_ssize_t min_length = 0;
+    for (Py_ssize_t i = 0; i < seqlen; i++) {
+        PyObject *item = items[i];
+        int format = (format_mask >> i) & 1;
+        if (!format || PyUnicode_CheckExact(item)) {
+            assert(PyUnicode_Check(item));
+            min_length += PyUnicode_GET_LENGTH(item);
+        }
+        else if (PyLong_CheckExact(item)) {
+            /* No more than 10 decimal digits per digit, plus the sign */
+            min_length += 10 * _PyLong_DigitCount((PyLongObject *)item) + 1;
+        }
+        else if (PyFloat_CheckExact(item)) {
+            min_length += 24;
+        }
+    }
+
+    _PyUnicodeWriter writer;
+    _PyUnicodeWriter_Init(&writer);
+    writer.min_length = min_length;
+    for (Py_ssize_t i = 0; i < seqlen; i++) {
+        PyObject *item = items[i];
+        int res;
+        if (!((format_mask >> i) & 1) || PyUnicode_CheckExact(item)) {
+            res = _PyUnicodeWriter_WriteStr(&writer, item);
+        }
+        else if (PyLong_CheckExact(item)) {
+            res = _PyLong_FormatWriter(&writer, item, 10, 0);
+        }
+        else if (PyFloat_CheckExact(item)) {
+            char *buf = PyOS_double_to_string(PyFloat_AS_DOUBLE(item), 'r', 0,
+                                              Py_DTSF_ADD_DOT_0, NULL);
+            if (buf == NULL) {
+                goto error;
+            }
+            res = _PyUnicodeWriter_WriteASCIIString(&writer, buf, strlen(buf));
+            PyMem_Free(buf);
+        }
+        else {
+            PyObject *str = PyObject_Format(item, NULL);
+            if (str == NULL) {
+                goto error;
+            }
+            res = _PyUnicodeWriter_WriteStr(&writer, str);
+            Py_DECREF(str);
+        }
+        if (res < 0) {
+            goto error;
+        }
+    }
+    return _PyUnicodeWriter_Finish(&writer);
+
+error:
+    _PyUnicodeWriter_Dealloc(&writer);
+    return NULL;
+}
+
 void
 _PyUnicode_FastFill(PyObject *unicode, Py_ssize_t start, Py_ssize_t length,
                     Py_UCS4 fill_char)
@@ -1,7 +1,7 @@
 // Auto-generated by Programs/freeze_test_frozenmain.py
 unsigned char M_test_frozenmain[] = {
     227,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
-    0,0,0,0,0,243,170,0,0,0,149,0,90,0,80,0,
+    0,0,0,0,0,243,170,0,0,0,128,0,90,0,80,0,
     71,0,112,0,90,0,80,0,71,1,112,1,89,2,32,0,
     80,1,50,1,0,0,0,0,0,0,30,0,89,2,32,0,
     80,2,89,0,78,6,0,0,0,0,0,0,0,0,0,0,
@@ -1,5 +1,6 @@
 #include "Python.h"
 #include "pycore_critical_section.h"  // Py_BEGIN_CRITICAL_SECTION_MUT()
+#include "pycore_genobject.h"      // _PyGen_GetQualname()
 #include "pycore_interp.h"        // PyInterpreterState.warnings
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
@@ -1405,7 +1406,7 @@ _PyErr_WarnUnawaitedAgenMethod(PyAsyncGenObject *agen, PyObject *method)
     PyObject *exc = PyErr_GetRaisedException();
     if (_PyErr_WarnFormat((PyObject *)agen, PyExc_RuntimeWarning, 1,
                           "coroutine method %R of %R was never awaited",
-                          method, agen->ag_qualname) < 0)
+                          method, _PyGen_GetQualname((PyGenObject *)agen)) < 0)
     {
         PyErr_WriteUnraisable((PyObject *)agen);
     }
@@ -1454,7 +1455,7 @@ _PyErr_WarnUnawaitedCoroutine(PyObject *coro)
     if (!warned) {
         if (_PyErr_WarnFormat(coro, PyExc_RuntimeWarning, 1,
                               "coroutine '%S' was never awaited",
-                              ((PyCoroObject *)coro)->cr_qualname) < 0)
+                              _PyGen_GetQualname((PyGenObject *)coro)) < 0)
         {
             PyErr_WriteUnraisable(coro);
         }
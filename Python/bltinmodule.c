@@ -3140,6 +3140,44 @@ zip_next(zipobject *lz)
     return NULL;
 }
 
+int
+_PyZip_IsPair(PyObject *self)
+{
+    assert(Py_IS_TYPE(self, &PyZip_Type));
+    return ((zipobject *)self)->tuplesize == 2;
+}
+
+int
+_PyZip_NextPair(PyObject *self, PyObject **first, PyObject **second)
+{
+    zipobject *lz = (zipobject *)self;
+    assert(_PyZip_IsPair(self));
+    if (lz->strict) {
+        PyObject *result = zip_next(lz);
+        if (result == NULL) {
+            return 0;
+        }
+        *first = Py_NewRef(PyTuple_GET_ITEM(result, 0));
+        *second = Py_NewRef(PyTuple_GET_ITEM(result, 1));
+        Py_DECREF(result);
+        return 1;
+    }
+    PyObject *it = PyTuple_GET_ITEM(lz->ittuple, 0);
+    PyObject *item0 = (*Py_TYPE(it)->tp_iternext)(it);
+    if (item0 == NULL) {
+        return 0;
+    }
+    it = PyTuple_GET_ITEM(lz->ittuple, 1);
+    PyObject *item1 = (*Py_TYPE(it)->tp_iternext)(it);
+    if (item1 == NULL) {
+        Py_DECREF(item0);
+        return 0;
+    }
+    *first = item0;
+    *second = item1;
+    return 1;
+}
+
 static PyObject *
 zip_reduce(zipobject *lz, PyObject *Py_UNUSED(ignored))
 {
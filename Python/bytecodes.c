@@ -101,7 +101,6 @@ dummy_func(
     PyObject *codeobj;
     PyObject *cond;
     PyObject *descr;
-    _PyInterpreterFrame  entry_frame;
     PyObject *exc;
     PyObject *exit;
     PyObject *fget;
@@ -328,6 +327,10 @@ dummy_func(
             DEAD(value2);
         }
 
+        super(LOAD_FAST__LOAD_FAST) = LOAD_FAST + LOAD_FAST;
+        super(LOAD_DEREF__LOAD_DEREF) = LOAD_DEREF + LOAD_DEREF;
+        super(LOAD_DEREF__LOAD_FAST) = LOAD_DEREF + LOAD_FAST;
+
         pure inst(POP_TOP, (value --)) {
             DECREF_INPUTS();
         }
@@ -491,6 +494,7 @@ dummy_func(
             BINARY_OP_ADD_FLOAT,
             BINARY_OP_SUBTRACT_FLOAT,
             BINARY_OP_ADD_UNICODE,
+            BINARY_OP_REMAINDER_UNICODE,
             // BINARY_OP_INPLACE_ADD_UNICODE,  // See comments at that opcode.
         };
 
@@ -512,39 +516,24 @@ dummy_func(
         }
 
         pure op(_BINARY_OP_MULTIPLY_INT, (left, right -- res)) {
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
-
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Multiply((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
         }
 
         pure op(_BINARY_OP_ADD_INT, (left, right -- res)) {
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
-
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Add((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
         }
 
         pure op(_BINARY_OP_SUBTRACT_INT, (left, right -- res)) {
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
-
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Subtract((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
@@ -647,6 +636,29 @@ dummy_func(
         macro(BINARY_OP_ADD_UNICODE) =
             _GUARD_BOTH_UNICODE + unused/1 + _BINARY_OP_ADD_UNICODE;
 
+        op(_GUARD_UNICODE_FORMAT, (left, right -- left, right)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            EXIT_IF(!PyUnicode_CheckExact(left_o));
+            /* A str subclass on the right could override __rmod__ */
+            EXIT_IF(PyUnicode_Check(right_o) && !PyUnicode_CheckExact(right_o));
+        }
+
+        op(_BINARY_OP_REMAINDER_UNICODE, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Format(left_o, right_o);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(BINARY_OP_REMAINDER_UNICODE) =
+            _GUARD_UNICODE_FORMAT + unused/1 + _BINARY_OP_REMAINDER_UNICODE;
+
         // This is a subtle one. It's a super-instruction for
         // BINARY_OP_ADD_UNICODE followed by STORE_FAST
         // where the store goes into the left argument.
@@ -1018,7 +1030,7 @@ dummy_func(
         }
 
         tier1 inst(INTERPRETER_EXIT, (retval --)) {
-            assert(frame == &entry_frame);
+            assert(frame->owner == FRAME_OWNED_BY_CSTACK);
             assert(_PyFrame_IsIncomplete(frame));
             /* Restore previous frame and return. */
             tstate->current_frame = frame->previous;
@@ -1034,7 +1046,7 @@ dummy_func(
         // is pushed to a different frame, the callers' frame.
         inst(RETURN_VALUE, (retval -- res)) {
             #if TIER_ONE
-            assert(frame != &entry_frame);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
             #endif
             _PyStackRef temp = retval;
             DEAD(retval);
@@ -1051,6 +1063,8 @@ dummy_func(
             LLTRACE_RESUME_FRAME();
         }
 
+        super(LOAD_FAST__RETURN_VALUE) = LOAD_FAST + RETURN_VALUE;
+
         tier1 op(_RETURN_VALUE_EVENT, (val -- val)) {
             int err = _Py_call_instrumentation_arg(
                     tstate, PY_MONITORING_EVENT_PY_RETURN,
@@ -1133,7 +1147,7 @@ dummy_func(
             PyObject *receiver_o = PyStackRef_AsPyObjectBorrow(receiver);
 
             PyObject *retval_o;
-            assert(frame != &entry_frame);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
             if ((tstate->interp->eval_frame == NULL) &&
                 (Py_TYPE(receiver_o) == &PyGen_Type || Py_TYPE(receiver_o) == &PyCoro_Type) &&
                 ((PyGenObject *)receiver_o)->gi_frame_state < FRAME_EXECUTING)
@@ -1207,7 +1221,7 @@ dummy_func(
             // The compiler treats any exception raised here as a failed close()
             // or throw() call.
             #if TIER_ONE
-            assert(frame != &entry_frame);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
             #endif
             frame->instr_ptr++;
             PyGenObject *gen = _PyGen_GetGeneratorFromFrame(frame);
@@ -1303,7 +1317,9 @@ dummy_func(
 
         tier1 inst(CLEANUP_THROW, (sub_iter_st, last_sent_val_st, exc_value_st -- none, value)) {
             PyObject *exc_value = PyStackRef_AsPyObjectBorrow(exc_value_st);
+        #if !Py_TAIL_CALL_INTERP
             assert(throwflag);
+        #endif
             assert(exc_value && PyExceptionInstance_Check(exc_value));
 
             int matches = PyErr_GivenExceptionMatches(exc_value, PyExc_StopIteration);
@@ -1786,6 +1802,22 @@ dummy_func(
             str = PyStackRef_FromPyObjectSteal(str_o);
         }
 
+        /* BUILD_STRING fused with the FORMAT_SIMPLEs of its pieces.
+         * Bit i of format_mask is set if pieces[i] still needs formatting. */
+        tier2 op(_BUILD_STRING_FORMAT, (format_mask/4, pieces[oparg] -- str)) {
+            STACKREFS_TO_PYOBJECTS(pieces, oparg, pieces_o);
+            if (CONVERSION_FAILED(pieces_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            PyObject *str_o = _PyUnicode_JoinFormatted(pieces_o, oparg,
+                                                     (uintptr_t)format_mask);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(pieces_o);
+            DECREF_INPUTS();
+            ERROR_IF(str_o == NULL, error);
+            str = PyStackRef_FromPyObjectSteal(str_o);
+        }
+
         inst(BUILD_TUPLE, (values[oparg] -- tup)) {
             PyObject *tup_o = _PyTuple_FromStackRefSteal(values, oparg);
             INPUTS_DEAD();
@@ -2067,6 +2099,7 @@ dummy_func(
             LOAD_ATTR_METHOD_LAZY_DICT,
             LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
             LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
+            LOAD_ATTR_POLYMORPHIC,
         };
 
         specializing op(_SPECIALIZE_LOAD_ATTR, (counter/1, owner -- owner)) {
@@ -2169,6 +2202,63 @@ dummy_func(
             _LOAD_ATTR_INSTANCE_VALUE +
             unused/5;  // Skip over rest of cache
 
+        /* The shape guards of LOAD_ATTR_POLYMORPHIC try the cached type
+         * versions in turn, leaving the index of the matching one (or 3,
+         * if none match) on the stack for _LOAD_ATTR_POLYMORPHIC. */
+        op(_GUARD_SHAPE_VERSION_0, (type_version/2, owner -- owner, shape_index: uintptr_t)) {
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            shape_index = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+        }
+
+        op(_GUARD_SHAPE_VERSION_1, (type_version/2, owner, index: uintptr_t -- owner, shape_index: uintptr_t)) {
+            assert(type_version != 0);
+            shape_index = index;
+            DEAD(index);
+            if (shape_index == 1) {
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                shape_index += FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+            }
+        }
+
+        op(_GUARD_SHAPE_VERSION_2, (type_version/2, owner, index: uintptr_t -- owner, shape_index: uintptr_t)) {
+            shape_index = index;
+            DEAD(index);
+            if (shape_index == 2) {
+                /* A zero version means only two shapes are cached */
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                shape_index += type_version == 0 ||
+                    FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+            }
+        }
+
+        op(_LOAD_ATTR_POLYMORPHIC, (shapes/2, owner, shape_index: uintptr_t -- attr, null if (oparg & 1))) {
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            uintptr_t index = shape_index;
+            DEAD(shape_index);
+            // Clear shape_index from stack in case we need to deopt
+            POP_DEAD_INPUTS();
+            DEOPT_IF(index == 3);
+            uint8_t shape = (uint8_t)(shapes >> (8 * index));
+            if (shape & POLYMORPHIC_SHAPE_INLINE_VALUES) {
+                assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+                DEOPT_IF(!_PyObject_InlineValues(owner_o)->valid);
+            }
+            PyObject *attr_o = ((PyObject **)owner_o)[shape & POLYMORPHIC_SHAPE_MAX_OFFSET];
+            DEOPT_IF(attr_o == NULL);
+            STAT_INC(LOAD_ATTR, hit);
+            null = PyStackRef_NULL;
+            attr = PyStackRef_FromPyObjectNew(attr_o);
+            PyStackRef_CLOSE(owner);
+        }
+
+        macro(LOAD_ATTR_POLYMORPHIC) =
+            unused/1 +
+            _GUARD_SHAPE_VERSION_0 +
+            _GUARD_SHAPE_VERSION_1 +
+            _GUARD_SHAPE_VERSION_2 +
+            _LOAD_ATTR_POLYMORPHIC;
+
         op(_CHECK_ATTR_MODULE_PUSH_KEYS, (dict_version/2, owner -- owner, mod_keys: PyDictKeysObject *)) {
             PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
             DEOPT_IF(Py_TYPE(owner_o)->tp_getattro != PyModule_Type.tp_getattro);
@@ -2408,6 +2498,11 @@ dummy_func(
                 DEOPT_IF(true);
             }
             _PyDict_NotifyEvent(tstate->interp, PyDict_EVENT_MODIFIED, dict, name, PyStackRef_AsPyObjectBorrow(value));
+            /* Ensure dict is GC tracked if it needs to be */
+            if (!_PyObject_GC_IS_TRACKED(dict) &&
+                _PyObject_GC_MAY_BE_TRACKED(PyStackRef_AsPyObjectBorrow(value))) {
+                _PyObject_GC_TRACK(dict);
+            }
             FT_ATOMIC_STORE_PTR_RELEASE(ep->me_value, PyStackRef_AsPyObjectSteal(value));
             UNLOCK_OBJECT(dict);
 
@@ -2445,6 +2540,9 @@ dummy_func(
             COMPARE_OP_FLOAT,
             COMPARE_OP_INT,
             COMPARE_OP_STR,
+            COMPARE_OP_INT_FLOAT,
+            COMPARE_OP_BYTES,
+            COMPARE_OP_TUPLE,
         };
 
         specializing op(_SPECIALIZE_COMPARE_OP, (counter/1, left, right -- left, right)) {
@@ -2547,6 +2645,72 @@ dummy_func(
             // It's always a bool, so we don't care about oparg & 16.
         }
 
+        // Compares a compact int with a float, in either order
+        inst(COMPARE_OP_INT_FLOAT, (unused/1, left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            PyObject *int_o;
+            double dleft, dright;
+
+            if (PyFloat_CheckExact(left_o)) {
+                int_o = right_o;
+                DEOPT_IF(!PyLong_CheckExact(int_o));
+                DEOPT_IF(!_PyLong_IsCompact((PyLongObject *)int_o));
+                dleft = PyFloat_AS_DOUBLE(left_o);
+                dright = (double)_PyLong_CompactValue((PyLongObject *)int_o);
+            }
+            else {
+                int_o = left_o;
+                DEOPT_IF(!PyLong_CheckExact(int_o));
+                DEOPT_IF(!PyFloat_CheckExact(right_o));
+                DEOPT_IF(!_PyLong_IsCompact((PyLongObject *)int_o));
+                dleft = (double)_PyLong_CompactValue((PyLongObject *)int_o);
+                dright = PyFloat_AS_DOUBLE(right_o);
+            }
+            STAT_INC(COMPARE_OP, hit);
+            // Compact ints are exactly representable as doubles
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            DECREF_INPUTS();
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+        }
+
+        // Similar to COMPARE_OP_STR
+        inst(COMPARE_OP_BYTES, (unused/1, left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            DEOPT_IF(!PyBytes_CheckExact(left_o));
+            DEOPT_IF(!PyBytes_CheckExact(right_o));
+            STAT_INC(COMPARE_OP, hit);
+            int eq = _PyBytes_Equal(left_o, right_o);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            DECREF_INPUTS();
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+        }
+
+        inst(COMPARE_OP_TUPLE, (unused/1, left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            DEOPT_IF(!PyTuple_CheckExact(left_o));
+            DEOPT_IF(!PyTuple_CheckExact(right_o));
+            STAT_INC(COMPARE_OP, hit);
+            PyObject *res_o = _PyTuple_RichCompare(left_o, right_o, oparg >> 5);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            if (oparg & 16) {
+                int res_bool = PyObject_IsTrue(res_o);
+                Py_DECREF(res_o);
+                ERROR_IF(res_bool < 0, error);
+                res = res_bool ? PyStackRef_True : PyStackRef_False;
+            }
+            else {
+                res = PyStackRef_FromPyObjectSteal(res_o);
+            }
+        }
+
         inst(IS_OP, (left, right -- b)) {
             int res = Py_Is(PyStackRef_AsPyObjectBorrow(left), PyStackRef_AsPyObjectBorrow(right)) ^ oparg;
             DECREF_INPUTS();
@@ -2556,6 +2720,7 @@ dummy_func(
         family(CONTAINS_OP, INLINE_CACHE_ENTRIES_CONTAINS_OP) = {
             CONTAINS_OP_SET,
             CONTAINS_OP_DICT,
+            CONTAINS_OP_TUPLE,
         };
 
         op(_CONTAINS_OP, (left, right -- b)) {
@@ -2607,6 +2772,18 @@ dummy_func(
             b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
         }
 
+        inst(CONTAINS_OP_TUPLE, (unused/1, left, right -- b)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            DEOPT_IF(!PyTuple_CheckExact(right_o));
+            STAT_INC(CONTAINS_OP, hit);
+            int res = _PyTuple_Contains(right_o, left_o);
+            DECREF_INPUTS();
+            ERROR_IF(res < 0, error);
+            b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
+        }
+
         inst(CHECK_EG_MATCH, (exc_value_st, match_type_st -- rest, match)) {
             PyObject *exc_value = PyStackRef_AsPyObjectBorrow(exc_value_st);
             PyObject *match_type = PyStackRef_AsPyObjectBorrow(match_type_st);
@@ -2690,7 +2867,8 @@ dummy_func(
                     ERROR_IF(optimized < 0, error);
                 }
                 else {
-                    this_instr[1].counter = initial_jump_backoff_counter();
+                    this_instr[1].counter = initial_jump_backoff_counter(
+                        tstate->interp->jump_backward_initial_value);
                     assert(tstate->previous_executor == NULL);
                     tstate->previous_executor = Py_None;
                     GOTO_TIER_TWO(executor);
@@ -2894,6 +3072,9 @@ dummy_func(
             FOR_ITER_TUPLE,
             FOR_ITER_RANGE,
             FOR_ITER_GEN,
+            FOR_ITER_DICT_ITEMS,
+            FOR_ITER_ENUMERATE,
+            FOR_ITER_ZIP,
         };
 
         specializing op(_SPECIALIZE_FOR_ITER, (counter/1, iter -- iter)) {
@@ -3152,6 +3333,95 @@ dummy_func(
             _FOR_ITER_GEN_FRAME +
             _PUSH_FRAME;
 
+        // The iterators below produce pairs. In tier one these instructions
+        // only guard on the iterator type, and the iterator recycles its
+        // result tuple. The tier two optimizer fuses them with a following
+        // UNPACK_SEQUENCE 2 (see fuse_pair_unpack), so no tuple is built.
+
+        op(_ITER_CHECK_DICT_ITEMS, (iter -- iter)) {
+            EXIT_IF(Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyDictIterItem_Type);
+        }
+
+        macro(FOR_ITER_DICT_ITEMS) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_DICT_ITEMS +
+            _FOR_ITER;
+
+        op(_ITER_CHECK_ENUMERATE, (iter -- iter)) {
+            EXIT_IF(Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyEnum_Type);
+        }
+
+        macro(FOR_ITER_ENUMERATE) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_ENUMERATE +
+            _FOR_ITER;
+
+        op(_ITER_CHECK_ZIP, (iter -- iter)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            EXIT_IF(Py_TYPE(iter_o) != &PyZip_Type);
+            EXIT_IF(!_PyZip_IsPair(iter_o));
+        }
+
+        macro(FOR_ITER_ZIP) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_ZIP +
+            _FOR_ITER;
+
+        tier2 op(_FOR_ITER_DICT_ITEMS_UNPACKED, (iter -- iter, value, key)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *key_o, *value_o;
+            int ok = _PyDictIter_NextItem(iter_o, &key_o, &value_o);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    ERROR_NO_POP();
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                EXIT_IF(true);
+            }
+            value = PyStackRef_FromPyObjectSteal(value_o);
+            key = PyStackRef_FromPyObjectSteal(key_o);
+        }
+
+        tier2 op(_FOR_ITER_ENUMERATE_UNPACKED, (iter -- iter, item, index)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *index_o, *item_o;
+            int ok = _PyEnum_NextPair(iter_o, &index_o, &item_o);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    if (!matches) {
+                        ERROR_NO_POP();
+                    }
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                EXIT_IF(true);
+            }
+            item = PyStackRef_FromPyObjectSteal(item_o);
+            index = PyStackRef_FromPyObjectSteal(index_o);
+        }
+
+        tier2 op(_FOR_ITER_ZIP_UNPACKED, (iter -- iter, second, first)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *first_o, *second_o;
+            int ok = _PyZip_NextPair(iter_o, &first_o, &second_o);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    if (!matches) {
+                        ERROR_NO_POP();
+                    }
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                EXIT_IF(true);
+            }
+            second = PyStackRef_FromPyObjectSteal(second_o);
+            first = PyStackRef_FromPyObjectSteal(first_o);
+        }
+
         inst(LOAD_SPECIAL, (owner -- attr, self_or_null)) {
             assert(oparg <= SPECIAL_MAX);
             PyObject *owner_o = PyStackRef_AsPyObjectSteal(owner);
@@ -4236,6 +4506,8 @@ dummy_func(
             CALL_KW_BOUND_METHOD,
             CALL_KW_PY,
             CALL_KW_NON_PY,
+            CALL_KW_BUILTIN_FAST,
+            CALL_KW_METHOD_DESCRIPTOR_FAST,
         };
 
         inst(INSTRUMENTED_CALL_KW, (counter/1, version/2 -- )) {
@@ -4481,10 +4753,119 @@ dummy_func(
             _CALL_KW_NON_PY +
             _CHECK_PERIODIC;
 
-        inst(INSTRUMENTED_CALL_FUNCTION_EX, ( -- )) {
+        op(_CALL_KW_BUILTIN_FAST, (callable[1], self_or_null[1], args[oparg], kwnames -- res)) {
+            /* Builtin METH_FASTCALL | METH_KEYWORDS functions */
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            EXIT_IF(!PyCFunction_CheckExact(callable_o));
+            EXIT_IF(PyCFunction_GET_FLAGS(callable_o) != (METH_FASTCALL | METH_KEYWORDS));
+            STAT_INC(CALL_KW, hit);
+            PyCFunctionFastWithKeywords cfunc =
+                (PyCFunctionFastWithKeywords)(void(*)(void))
+                PyCFunction_GET_FUNCTION(callable_o);
+
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            PyObject *res_o = cfunc(PyCFunction_GET_SELF(callable_o), args_o,
+                                    positional_args, kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+
+            PyStackRef_CLOSE(kwnames);
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            DEAD(self_or_null);
+            PyStackRef_CLOSE(callable[0]);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_BUILTIN_FAST) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_BUILTIN_FAST +
+            _CHECK_PERIODIC;
+
+        op(_CALL_KW_METHOD_DESCRIPTOR_FAST, (callable[1], self_or_null[1], args[oparg], kwnames -- res)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            EXIT_IF(positional_args == 0);
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+            EXIT_IF(!Py_IS_TYPE(method, &PyMethodDescr_Type));
+            PyMethodDef *meth = method->d_method;
+            EXIT_IF(meth->ml_flags != (METH_FASTCALL|METH_KEYWORDS));
+            PyTypeObject *d_type = method->d_common.d_type;
+            PyObject *self = PyStackRef_AsPyObjectBorrow(args[0]);
+            EXIT_IF(!Py_IS_TYPE(self, d_type));
+            STAT_INC(CALL_KW, hit);
+
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            PyCFunctionFastWithKeywords cfunc =
+                (PyCFunctionFastWithKeywords)(void(*)(void))meth->ml_meth;
+            PyObject *res_o = cfunc(self, (args_o + 1), positional_args - 1,
+                                    kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+
+            PyStackRef_CLOSE(kwnames);
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            DEAD(self_or_null);
+            PyStackRef_CLOSE(callable[0]);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_METHOD_DESCRIPTOR_FAST) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_METHOD_DESCRIPTOR_FAST +
+            _CHECK_PERIODIC;
+
+        family(CALL_FUNCTION_EX, INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX) = {
+            CALL_FUNCTION_EX_NON_PY,
+        };
+
+        inst(INSTRUMENTED_CALL_FUNCTION_EX, (counter/1 -- )) {
+            PAUSE_ADAPTIVE_COUNTER(this_instr[1].counter);
             GO_TO_INSTRUCTION(CALL_FUNCTION_EX);
         }
 
+        specializing op(_SPECIALIZE_CALL_FUNCTION_EX, (counter/1, func, unused, unused, unused if (oparg & 1) -- func, unused, unused, unused if (oparg & 1))) {
+            #if ENABLE_SPECIALIZATION_FT
+            if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
+                next_instr = this_instr;
+                _Py_Specialize_CallFunctionEx(func, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            OPCODE_DEFERRED_INC(CALL_FUNCTION_EX);
+            ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+            #endif  /* ENABLE_SPECIALIZATION_FT */
+        }
+
         op(_MAKE_CALLARGS_A_TUPLE, (func, unused, callargs, kwargs_in if (oparg & 1) -- func, unused, tuple, kwargs_out if (oparg & 1))) {
             PyObject *callargs_o = PyStackRef_AsPyObjectBorrow(callargs);
             if (PyTuple_CheckExact(callargs_o)) {
@@ -4567,8 +4948,8 @@ dummy_func(
                     if (new_frame == NULL) {
                         ERROR_NO_POP();
                     }
-                    assert(INSTRUCTION_SIZE == 1);
-                    frame->return_offset = 1;
+                    assert(INSTRUCTION_SIZE == 1 + INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
+                    frame->return_offset = INSTRUCTION_SIZE;
                     DISPATCH_INLINED(new_frame);
                 }
                 PyObject *callargs = PyStackRef_AsPyObjectBorrow(callargs_st);
@@ -4586,10 +4967,43 @@ dummy_func(
         }
 
         macro(CALL_FUNCTION_EX) =
+            _SPECIALIZE_CALL_FUNCTION_EX +
             _MAKE_CALLARGS_A_TUPLE +
             _DO_CALL_FUNCTION_EX +
             _CHECK_PERIODIC;
 
+        op(_CHECK_IS_NOT_PY_CALLABLE_EX, (func, unused, unused, unused if (oparg & 1) -- func, unused, unused, unused if (oparg & 1))) {
+            EXIT_IF(PyFunction_Check(PyStackRef_AsPyObjectBorrow(func)));
+        }
+
+        op(_CALL_FUNCTION_EX_NON_PY, (func_st, unused, callargs_st, kwargs_st if (oparg & 1) -- result)) {
+            /* Vectorcall-capable callables other than Python functions.
+             * The tuple items are passed directly, and a non-empty kwargs
+             * dict is unpacked into keyword names by the callee's vectorcall. */
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_st);
+            PyObject *callargs = PyStackRef_AsPyObjectBorrow(callargs_st);
+            assert(PyTuple_CheckExact(callargs));
+            PyObject *kwargs = PyStackRef_AsPyObjectBorrow(kwargs_st);
+            assert(kwargs == NULL || PyDict_CheckExact(kwargs));
+            STAT_INC(CALL_FUNCTION_EX, hit);
+            PyObject *result_o = PyObject_VectorcallDict(
+                func, _PyTuple_ITEMS(callargs), PyTuple_GET_SIZE(callargs),
+                kwargs);
+            PyStackRef_XCLOSE(kwargs_st);
+            DEAD(kwargs_st);
+            PyStackRef_CLOSE(callargs_st);
+            PyStackRef_CLOSE(func_st);
+            ERROR_IF(result_o == NULL, error);
+            result = PyStackRef_FromPyObjectSteal(result_o);
+        }
+
+        macro(CALL_FUNCTION_EX_NON_PY) =
+            unused/1 + // Skip over the counter
+            _CHECK_IS_NOT_PY_CALLABLE_EX +
+            _MAKE_CALLARGS_A_TUPLE +
+            _CALL_FUNCTION_EX_NON_PY +
+            _CHECK_PERIODIC;
+
 
         inst(MAKE_FUNCTION, (codeobj_st -- func)) {
             PyObject *codeobj = PyStackRef_AsPyObjectBorrow(codeobj_st);
@@ -4903,11 +5317,12 @@ dummy_func(
 
         tier2 op(_EXIT_TRACE, (exit_p/4 --)) {
             _PyExitData *exit = (_PyExitData *)exit_p;
+            exit->taken++;
             PyCodeObject *code = _PyFrame_GetCode(frame);
             _Py_CODEUNIT *target = _PyFrame_GetBytecode(frame) + exit->target;
         #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
-            if (lltrace >= 2) {
+            if (frame->lltrace >= 2) {
                 printf("SIDE EXIT: [UOp ");
                 _PyUOpPrint(&next_uop[-1]);
                 printf(", exit %u, temp %d, target %d -> %s]\n",
@@ -4921,18 +5336,21 @@ dummy_func(
                 Py_CLEAR(exit->executor);
             }
             if (exit->executor == NULL) {
-                _Py_BackoffCounter temperature = exit->temperature;
-                if (!backoff_counter_triggers(temperature)) {
-                    exit->temperature = advance_backoff_counter(temperature);
-                    tstate->previous_executor = (PyObject *)current_executor;
-                    GOTO_TIER_ONE(target);
-                }
                 _PyExecutorObject *executor;
                 if (target->op.code == ENTER_EXECUTOR) {
+                    /* The target already has a trace: link to it straight
+                     * away rather than bouncing through tier one while
+                     * this exit warms up. */
                     executor = code->co_executors->executors[target->op.arg];
                     Py_INCREF(executor);
                 }
                 else {
+                    _Py_BackoffCounter temperature = exit->temperature;
+                    if (!backoff_counter_triggers(temperature)) {
+                        exit->temperature = advance_backoff_counter(temperature);
+                        tstate->previous_executor = (PyObject *)current_executor;
+                        GOTO_TIER_ONE(target);
+                    }
                     int chain_depth = current_executor->vm_data.chain_depth + 1;
                     int optimized = _PyOptimizer_Optimize(frame, target, stack_pointer, &executor, chain_depth);
                     if (optimized <= 0) {
@@ -4971,6 +5389,89 @@ dummy_func(
             value = PyStackRef_FromPyObjectImmortal(ptr);
         }
 
+        /* _ENTER_INLINED and _RETURN_INLINED replace the call sequence
+         * and _RETURN_VALUE of a callee that the optimizer has inlined.
+         * See inline_call() in Python/optimizer_analysis.c. */
+        tier2 op(_ENTER_INLINED, (callable, self_or_null, args[oparg] -- self_or_null_out, unused[oparg])) {
+            /* The function has already been checked and is not needed.
+             * Dropping it leaves room for the inlined body's values. */
+            PyStackRef_CLOSE(callable);
+            self_or_null_out = self_or_null;
+            DEAD(self_or_null);
+            for (int i = 0; i < oparg; i++) {
+                args[i - 1] = args[i];
+            }
+            DEAD(args);
+        }
+
+        tier2 op(_RETURN_INLINED, (self_or_null[1], args[oparg], retval -- res)) {
+            _PyStackRef *arguments = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                arguments--;
+                total_args++;
+            }
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(arguments[i]);
+            }
+            DEAD(self_or_null);
+            res = retval;
+            DEAD(retval);
+        }
+
+        /* A callee whose body can deopt keeps the call's inputs on the
+         * stack, below the values pushed by the body, so that its frame
+         * can be made by _MATERIALIZE_INLINED_FRAME if a guard fails.
+         * operand0 is the stack level of the callable and operand1 the
+         * offset of the call. */
+        tier2 op(_ENTER_GUARDED_INLINED, (--)) {
+        }
+
+        tier2 op(_RETURN_GUARDED_INLINED, (callable, self_or_null[1], args[oparg], retval -- res)) {
+            _PyStackRef *arguments = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                arguments--;
+                total_args++;
+            }
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(arguments[i]);
+            }
+            DEAD(self_or_null);
+            PyStackRef_CLOSE(callable);
+            res = retval;
+            DEAD(retval);
+        }
+
+        /* Pushes the frame of a guarded inlined callee, as
+         * _INIT_CALL_PY_EXACT_ARGS and _PUSH_FRAME would have done, moving
+         * the values pushed so far by the body onto the new frame's stack.
+         * Only used in the exit stubs of the inlined body, just before the
+         * _DEOPT or _EXIT_TRACE that continues in the callee. */
+        tier2 op(_MATERIALIZE_INLINED_FRAME, (level/1, call_target/2 --)) {
+            PyCodeObject *code = _PyFrame_GetCode(frame);
+            _PyStackRef *callable = frame->localsplus + code->co_nlocalsplus + level;
+            _PyStackRef *args = callable + 2;
+            int has_self = !PyStackRef_IsNull(callable[1]);
+            _PyInterpreterFrame *new_frame = _PyFrame_PushUnchecked(tstate, callable[0], oparg + has_self, frame);
+            _PyStackRef *first_non_self_local = new_frame->localsplus + has_self;
+            new_frame->localsplus[0] = callable[1];
+            for (int i = 0; i < oparg; i++) {
+                first_non_self_local[i] = args[i];
+            }
+            for (_PyStackRef *value = args + oparg; value < stack_pointer; value++) {
+                _PyFrame_StackPush(new_frame, *value);
+            }
+            frame->instr_ptr = _PyCode_CODE(code) + call_target;
+            frame->return_offset = 1 + INLINE_CACHE_ENTRIES_CALL;
+            _PyFrame_SetStackPointer(frame, callable);
+            CALL_STAT_INC(inlined_py_calls);
+            frame = tstate->current_frame = new_frame;
+            tstate->py_recursion_remaining--;
+            LOAD_SP();
+            LLTRACE_RESUME_FRAME();
+        }
+
         tier2 pure op(_LOAD_CONST_INLINE_WITH_NULL, (ptr/4 -- value, null)) {
             value = PyStackRef_FromPyObjectNew(ptr);
             null = PyStackRef_NULL;
@@ -4987,6 +5488,16 @@ dummy_func(
             DEOPT_IF(func->func_version != func_version);
         }
 
+        /* _GUARD_TYPE_VERSION for a local that is not on the stack.
+         * Only emitted by the optimizer, into the preheader of a loop. */
+        tier2 op(_GUARD_LOCAL_TYPE_VERSION, (type_version/2 --)) {
+            _PyStackRef value = GETLOCAL(oparg);
+            EXIT_IF(PyStackRef_IsNull(value));
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(value));
+            assert(type_version != 0);
+            EXIT_IF(FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version);
+        }
+
         tier2 op(_LOAD_GLOBAL_MODULE, (index/1 -- res, null if (oparg & 1))) {
             PyDictObject *dict = (PyDictObject *)GLOBALS();
             PyDictUnicodeEntry *entries = DK_UNICODE_ENTRIES(dict->ma_keys);
@@ -5032,10 +5543,11 @@ dummy_func(
         tier2 op(_DYNAMIC_EXIT, (exit_p/4 --)) {
             tstate->previous_executor = (PyObject *)current_executor;
             _PyExitData *exit = (_PyExitData *)exit_p;
+            exit->taken++;
             _Py_CODEUNIT *target = frame->instr_ptr;
         #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
-            if (lltrace >= 2) {
+            if (frame->lltrace >= 2) {
                 printf("DYNAMIC EXIT: [UOp ");
                 _PyUOpPrint(&next_uop[-1]);
                 printf(", exit %u, temp %d, target %d -> %s]\n",
@@ -5077,6 +5589,7 @@ dummy_func(
             current_executor = (_PyExecutorObject*)executor;
 #endif
             assert(((_PyExecutorObject *)executor)->vm_data.valid);
+            ((_PyExecutorObject *)executor)->vm_data.entries++;
         }
 
         tier2 op(_MAKE_WARM, (--)) {
@@ -5098,6 +5611,7 @@ dummy_func(
         }
 
         tier2 op(_DEOPT, (--)) {
+            current_executor->vm_data.deopts++;
             EXIT_TO_TIER1();
         }
 
@@ -5119,6 +5633,144 @@ dummy_func(
             assert(tstate->tracing || eval_breaker == FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version));
         }
 
+        label(pop_4_error) {
+            STACK_SHRINK(1);
+            goto pop_3_error;
+        }
+
+        label(pop_3_error) {
+            STACK_SHRINK(1);
+            goto pop_2_error;
+        }
+
+        label(pop_2_error) {
+            STACK_SHRINK(1);
+            goto pop_1_error;
+        }
+
+        label(pop_1_error) {
+            STACK_SHRINK(1);
+            goto error;
+        }
+
+        label(error) {
+            /* Double-check exception status. */
+#ifdef NDEBUG
+            if (!_PyErr_Occurred(tstate)) {
+                _PyErr_SetString(tstate, PyExc_SystemError,
+                                 "error return without exception set");
+            }
+#else
+            assert(_PyErr_Occurred(tstate));
+#endif
+
+            /* Log traceback info. */
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
+            if (!_PyFrame_IsIncomplete(frame)) {
+                PyFrameObject *f = _PyFrame_GetFrameObject(frame);
+                if (f != NULL) {
+                    PyTraceBack_Here(f);
+                }
+            }
+            _PyEval_MonitorRaise(tstate, frame, next_instr-1);
+            goto exception_unwind;
+        }
+
+        label(exception_unwind) {
+            /* We can't use frame->instr_ptr here, as RERAISE may have set it */
+            int offset = INSTR_OFFSET()-1;
+            int level, handler, lasti;
+            if (get_exception_handler(_PyFrame_GetCode(frame), offset, &level, &handler, &lasti) == 0) {
+                // No handlers, so exit.
+                assert(_PyErr_Occurred(tstate));
+
+                /* Pop remaining stack entries. */
+                _PyStackRef *stackbase = _PyFrame_Stackbase(frame);
+                while (stack_pointer > stackbase) {
+                    PyStackRef_XCLOSE(POP());
+                }
+                assert(STACK_LEVEL() == 0);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                monitor_unwind(tstate, frame, next_instr-1);
+                goto exit_unwind;
+            }
+
+            assert(STACK_LEVEL() >= level);
+            _PyStackRef *new_top = _PyFrame_Stackbase(frame) + level;
+            while (stack_pointer > new_top) {
+                PyStackRef_XCLOSE(POP());
+            }
+            if (lasti) {
+                int frame_lasti = _PyInterpreterFrame_LASTI(frame);
+                PyObject *lasti = PyLong_FromLong(frame_lasti);
+                if (lasti == NULL) {
+                    goto exception_unwind;
+                }
+                PUSH(PyStackRef_FromPyObjectSteal(lasti));
+            }
+
+            /* Make the raw exception data
+                available to the handler,
+                so a program can emulate the
+                Python main loop. */
+            PyObject *exc = _PyErr_GetRaisedException(tstate);
+            PUSH(PyStackRef_FromPyObjectSteal(exc));
+            next_instr = _PyFrame_GetBytecode(frame) + handler;
+
+            if (monitor_handled(tstate, frame, next_instr, exc) < 0) {
+                goto exception_unwind;
+            }
+            /* Resume normal execution */
+#ifdef LLTRACE
+            if (frame->lltrace >= 5) {
+                lltrace_resume_frame(frame);
+            }
+#endif
+            DISPATCH();
+        }
+
+        label(exit_unwind) {
+            assert(_PyErr_Occurred(tstate));
+            _Py_LeaveRecursiveCallPy(tstate);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
+            // GH-99729: We need to unlink the frame *before* clearing it:
+            _PyInterpreterFrame *dying = frame;
+            frame = tstate->current_frame = dying->previous;
+            _PyEval_FrameClearAndPop(tstate, dying);
+            frame->return_offset = 0;
+            if (frame->owner == FRAME_OWNED_BY_CSTACK) {
+                /* Restore previous frame and exit */
+                tstate->current_frame = frame->previous;
+                tstate->c_recursion_remaining += PY_EVAL_C_STACK_UNITS;
+                return NULL;
+            }
+            goto resume_with_error;
+        }
+
+        label(resume_with_error) {
+            next_instr = frame->instr_ptr;
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            goto error;
+        }
+
+        label(start_frame) {
+            if (_Py_EnterRecursivePy(tstate)) {
+                goto exit_unwind;
+            }
+            next_instr = frame->instr_ptr;
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            LLTRACE_RESUME_FRAME();
+
+#ifdef Py_DEBUG
+            /* _PyEval_EvalFrameDefault() must not be called with an exception set,
+               because it can clear it (directly or indirectly) and so the
+               caller loses its exception */
+            assert(!_PyErr_Occurred(tstate));
+#endif
+
+            DISPATCH();
+        }
+
 // END BYTECODES //
 
     }
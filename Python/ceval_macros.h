@@ -59,6 +59,10 @@
     #define USE_COMPUTED_GOTOS 0
 #endif
 
+#ifndef Py_TAIL_CALL_INTERP
+#  define Py_TAIL_CALL_INTERP 0
+#endif
+
 #ifdef Py_STATS
 #define INSTRUCTION_STATS(op) \
     do { \
@@ -70,17 +74,63 @@
 #define INSTRUCTION_STATS(op) ((void)0)
 #endif
 
-#if USE_COMPUTED_GOTOS
+/* With the tail-calling interpreter, every instruction and label of the
+ * generated interpreter is a separate function, and dispatching to the next
+ * one is a guaranteed tail call. The interpreter state that the computed goto
+ * interpreter keeps in locals of _PyEval_EvalFrameDefault() is passed along
+ * as arguments (see TAIL_CALL_PARAMS), so that it stays in registers.
+ */
+#if Py_TAIL_CALL_INTERP
+#  ifndef Py_MUSTTAIL
+#    if _Py__has_attribute(musttail)
+#      define Py_MUSTTAIL __attribute__((musttail))
+#    else
+#      error "The tail-calling interpreter requires the musttail attribute"
+#    endif
+#  endif
+#  if _Py__has_attribute(preserve_none)
+#    define Py_PRESERVE_NONE_CC __attribute__((preserve_none))
+#  else
+#    define Py_PRESERVE_NONE_CC
+#  endif
+#  ifdef Py_STATS
+#    define TAIL_CALL_PARAMS _PyInterpreterFrame *frame, _PyStackRef *stack_pointer, \
+                             PyThreadState *tstate, _Py_CODEUNIT *next_instr, int opcode, \
+                             int oparg, int lastopcode
+#    define TAIL_CALL_ARGS frame, stack_pointer, tstate, next_instr, opcode, oparg, lastopcode
+#  else
+#    define TAIL_CALL_PARAMS _PyInterpreterFrame *frame, _PyStackRef *stack_pointer, \
+                             PyThreadState *tstate, _Py_CODEUNIT *next_instr, int opcode, \
+                             int oparg
+#    define TAIL_CALL_ARGS frame, stack_pointer, tstate, next_instr, opcode, oparg
+#  endif
+   Py_PRESERVE_NONE_CC typedef PyObject *(*py_tail_call_funcptr)(TAIL_CALL_PARAMS);
+
+#  define TARGET(op) Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_##op(TAIL_CALL_PARAMS)
+#  define DISPATCH_GOTO() \
+       do { \
+           Py_MUSTTAIL return (INSTRUCTION_TABLE[opcode])(TAIL_CALL_ARGS); \
+       } while (0)
+#  define JUMP_TO_LABEL(name) \
+       do { \
+           Py_MUSTTAIL return (_TAIL_CALL_##name)(TAIL_CALL_ARGS); \
+       } while (0)
+#  define LABEL(name) TARGET(name)
+#elif USE_COMPUTED_GOTOS
 #  define TARGET(op) TARGET_##op:
 #  define DISPATCH_GOTO() goto *opcode_targets[opcode]
+#  define JUMP_TO_LABEL(name) goto name
+#  define LABEL(name) name:
 #else
 #  define TARGET(op) case op: TARGET_##op:
 #  define DISPATCH_GOTO() goto dispatch_opcode
+#  define JUMP_TO_LABEL(name) goto name
+#  define LABEL(name) name:
 #endif
 
 /* PRE_DISPATCH_GOTO() does lltrace if enabled. Normally a no-op */
 #ifdef LLTRACE
-#define PRE_DISPATCH_GOTO() if (lltrace >= 5) { \
+#define PRE_DISPATCH_GOTO() if (frame->lltrace >= 5) { \
     lltrace_instruction(frame, stack_pointer, next_instr, opcode, oparg); }
 #else
 #define PRE_DISPATCH_GOTO() ((void)0)
@@ -89,10 +139,11 @@
 #if LLTRACE
 #define LLTRACE_RESUME_FRAME() \
 do { \
-    lltrace = maybe_lltrace_resume_frame(frame, &entry_frame, GLOBALS()); \
+    int lltrace = maybe_lltrace_resume_frame(frame, GLOBALS()); \
     if (lltrace < 0) { \
-        goto exit_unwind; \
+        JUMP_TO_LABEL(exit_unwind); \
     } \
+    frame->lltrace = lltrace; \
 } while (0)
 #else
 #define LLTRACE_RESUME_FRAME() ((void)0)
@@ -128,11 +179,11 @@ do { \
         assert((NEW_FRAME)->previous == frame);         \
         frame = tstate->current_frame = (NEW_FRAME);     \
         CALL_STAT_INC(inlined_py_calls);                \
-        goto start_frame;                               \
+        JUMP_TO_LABEL(start_frame);                     \
     } while (0)
 
 // Use this instead of 'goto error' so Tier 2 can go to a different label
-#define GOTO_ERROR(LABEL) goto LABEL
+#define GOTO_ERROR(LABEL) JUMP_TO_LABEL(LABEL)
 
 /* Tuple access macros */
 
@@ -192,7 +243,11 @@ GETITEM(PyObject *v, Py_ssize_t i) {
 */
 
 #define PREDICT_ID(op)          PRED_##op
+#if Py_TAIL_CALL_INTERP
+#define PREDICTED(op)
+#else
 #define PREDICTED(op)           PREDICT_ID(op):
+#endif
 
 
 /* Stack manipulation macros */
@@ -238,7 +293,7 @@ GETITEM(PyObject *v, Py_ssize_t i) {
 #endif
 
 #define WITHIN_STACK_BOUNDS() \
-   (frame == &entry_frame || (STACK_LEVEL() >= 0 && STACK_LEVEL() <= STACK_SIZE()))
+   (frame->owner == FRAME_OWNED_BY_CSTACK || (STACK_LEVEL() >= 0 && STACK_LEVEL() <= STACK_SIZE()))
 
 /* Data access macros */
 #define FRAME_CO_CONSTS (_PyFrame_GetCode(frame)->co_consts)
@@ -259,7 +314,23 @@ GETITEM(PyObject *v, Py_ssize_t i) {
                                      GETLOCAL(i) = value; \
                                      PyStackRef_XCLOSE(tmp); } while (0)
 
+#if Py_TAIL_CALL_INTERP
+/* Restart the generic instruction from scratch: frame->instr_ptr still
+ * points at the specialized instruction that deoptimized. */
+#define GO_TO_INSTRUCTION(op) \
+    do { \
+        _Py_CODEUNIT *this_op = frame->instr_ptr; \
+        Py_MUSTTAIL return (INSTRUCTION_TABLE[op])(frame, stack_pointer, tstate, \
+                                                   this_op, opcode, oparg TAIL_CALL_LASTOPCODE); \
+    } while (0)
+#ifdef Py_STATS
+#define TAIL_CALL_LASTOPCODE , lastopcode
+#else
+#define TAIL_CALL_LASTOPCODE
+#endif
+#else
 #define GO_TO_INSTRUCTION(op) goto PREDICT_ID(op)
+#endif
 
 #ifdef Py_STATS
 #define UPDATE_MISS_STATS(INSTNAME)                              \
@@ -367,7 +438,7 @@ do { \
         stack_pointer = _PyFrame_GetStackPointer(frame); \
         if (next_instr == NULL) { \
             next_instr = (dest)+1; \
-            goto error; \
+            JUMP_TO_LABEL(error); \
         } \
     } \
 } while (0);
@@ -411,7 +482,7 @@ do {                                                   \
     tstate->previous_executor = NULL;                  \
     frame = tstate->current_frame;                     \
     if (next_instr == NULL) {                          \
-        goto resume_with_error;                        \
+        JUMP_TO_LABEL(resume_with_error);              \
     }                                                  \
     stack_pointer = _PyFrame_GetStackPointer(frame);   \
     DISPATCH();                                        \
@@ -1266,6 +1266,26 @@ sys__clear_internal_caches(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__clear_internal_caches_impl(module);
 }
 
+PyDoc_STRVAR(sys__get_executor_stats__doc__,
+"_get_executor_stats($module, /)\n"
+"--\n"
+"\n"
+"Return the execution counters of the tier 2 executors.\n"
+"\n"
+"Returns a list with a dict per live executor.");
+
+#define SYS__GET_EXECUTOR_STATS_METHODDEF    \
+    {"_get_executor_stats", (PyCFunction)sys__get_executor_stats, METH_NOARGS, sys__get_executor_stats__doc__},
+
+static PyObject *
+sys__get_executor_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_executor_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_executor_stats_impl(module);
+}
+
 PyDoc_STRVAR(sys_is_finalizing__doc__,
 "is_finalizing($module, /)\n"
 "--\n"
@@ -1724,4 +1744,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=568b0a0069dc43e8 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=51e7ed1226c4214a input=a9049054013a1b77]*/
@@ -622,12 +622,8 @@
             _PyStackRef res;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Multiply((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
             if (res_o == NULL) JUMP_TO_ERROR();
             res = PyStackRef_FromPyObjectSteal(res_o);
             stack_pointer[-2] = res;
@@ -642,12 +638,8 @@
             _PyStackRef res;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Add((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
             if (res_o == NULL) JUMP_TO_ERROR();
             res = PyStackRef_FromPyObjectSteal(res_o);
             stack_pointer[-2] = res;
@@ -662,12 +654,8 @@
             _PyStackRef res;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
-            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
-            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Subtract((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
             if (res_o == NULL) JUMP_TO_ERROR();
             res = PyStackRef_FromPyObjectSteal(res_o);
             stack_pointer[-2] = res;
@@ -817,6 +805,47 @@
             break;
         }
 
+        case _GUARD_UNICODE_FORMAT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyUnicode_CheckExact(left_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            /* A str subclass on the right could override __rmod__ */
+            if (PyUnicode_Check(right_o) && !PyUnicode_CheckExact(right_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _BINARY_OP_REMAINDER_UNICODE: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(BINARY_OP, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = PyUnicode_Format(left_o, right_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _BINARY_OP_INPLACE_ADD_UNICODE: {
             _PyStackRef right;
             _PyStackRef left;
@@ -1362,7 +1391,7 @@
             _PyStackRef res;
             retval = stack_pointer[-1];
             #if TIER_ONE
-            assert(frame != &entry_frame);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
             #endif
             _PyStackRef temp = retval;
             stack_pointer += -1;
@@ -1500,7 +1529,7 @@
             // The compiler treats any exception raised here as a failed close()
             // or throw() call.
             #if TIER_ONE
-            assert(frame != &entry_frame);
+            assert(frame->owner != FRAME_OWNED_BY_CSTACK);
             #endif
             frame->instr_ptr++;
             PyGenObject *gen = _PyGen_GetGeneratorFromFrame(frame);
@@ -2168,6 +2197,35 @@
             break;
         }
 
+        case _BUILD_STRING_FORMAT: {
+            _PyStackRef *pieces;
+            _PyStackRef str;
+            oparg = CURRENT_OPARG();
+            pieces = &stack_pointer[-oparg];
+            PyObject *format_mask = (PyObject *)CURRENT_OPERAND0();
+            STACKREFS_TO_PYOBJECTS(pieces, oparg, pieces_o);
+            if (CONVERSION_FAILED(pieces_o)) {
+                for (int _i = oparg; --_i >= 0;) {
+                    PyStackRef_CLOSE(pieces[_i]);
+                }
+                if (true) JUMP_TO_ERROR();
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *str_o = _PyUnicode_JoinFormatted(pieces_o, oparg,
+                (uintptr_t)format_mask);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(pieces_o);
+            for (int _i = oparg; --_i >= 0;) {
+                PyStackRef_CLOSE(pieces[_i]);
+            }
+            if (str_o == NULL) JUMP_TO_ERROR();
+            str = PyStackRef_FromPyObjectSteal(str_o);
+            stack_pointer[-oparg] = str;
+            stack_pointer += 1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _BUILD_TUPLE: {
             _PyStackRef *values;
             _PyStackRef tup;
@@ -2666,6 +2724,97 @@
 
         /* _LOAD_ATTR_INSTANCE_VALUE is split on (oparg & 1) */
 
+        case _GUARD_SHAPE_VERSION_0: {
+            _PyStackRef owner;
+            uintptr_t shape_index;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            shape_index = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+            stack_pointer[0].bits = (uintptr_t)shape_index;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _GUARD_SHAPE_VERSION_1: {
+            uintptr_t index;
+            _PyStackRef owner;
+            uintptr_t shape_index;
+            index = (uintptr_t)stack_pointer[-1].bits;
+            owner = stack_pointer[-2];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            assert(type_version != 0);
+            shape_index = index;
+            if (shape_index == 1) {
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                shape_index += FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+            }
+            stack_pointer[-1].bits = (uintptr_t)shape_index;
+            break;
+        }
+
+        case _GUARD_SHAPE_VERSION_2: {
+            uintptr_t index;
+            _PyStackRef owner;
+            uintptr_t shape_index;
+            index = (uintptr_t)stack_pointer[-1].bits;
+            owner = stack_pointer[-2];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            shape_index = index;
+            if (shape_index == 2) {
+                /* A zero version means only two shapes are cached */
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                shape_index += type_version == 0 ||
+                FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version;
+            }
+            stack_pointer[-1].bits = (uintptr_t)shape_index;
+            break;
+        }
+
+        case _LOAD_ATTR_POLYMORPHIC: {
+            uintptr_t shape_index;
+            _PyStackRef owner;
+            _PyStackRef attr;
+            _PyStackRef null = PyStackRef_NULL;
+            oparg = CURRENT_OPARG();
+            shape_index = (uintptr_t)stack_pointer[-1].bits;
+            owner = stack_pointer[-2];
+            uint32_t shapes = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            uintptr_t index = shape_index;
+            // Clear shape_index from stack in case we need to deopt
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            if (index == 3) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            uint8_t shape = (uint8_t)(shapes >> (8 * index));
+            if (shape & POLYMORPHIC_SHAPE_INLINE_VALUES) {
+                assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+                if (!_PyObject_InlineValues(owner_o)->valid) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            PyObject *attr_o = ((PyObject **)owner_o)[shape & POLYMORPHIC_SHAPE_MAX_OFFSET];
+            if (attr_o == NULL) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(LOAD_ATTR, hit);
+            null = PyStackRef_NULL;
+            attr = PyStackRef_FromPyObjectNew(attr_o);
+            PyStackRef_CLOSE(owner);
+            stack_pointer[-1] = attr;
+            if (oparg & 1) stack_pointer[0] = null;
+            stack_pointer += (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_ATTR_MODULE_PUSH_KEYS: {
             _PyStackRef owner;
             PyDictKeysObject *mod_keys;
@@ -3023,6 +3172,11 @@
             _PyFrame_SetStackPointer(frame, stack_pointer);
             _PyDict_NotifyEvent(tstate->interp, PyDict_EVENT_MODIFIED, dict, name, PyStackRef_AsPyObjectBorrow(value));
             stack_pointer = _PyFrame_GetStackPointer(frame);
+            /* Ensure dict is GC tracked if it needs to be */
+            if (!_PyObject_GC_IS_TRACKED(dict) &&
+                _PyObject_GC_MAY_BE_TRACKED(PyStackRef_AsPyObjectBorrow(value))) {
+                _PyObject_GC_TRACK(dict);
+            }
             FT_ATOMIC_STORE_PTR_RELEASE(ep->me_value, PyStackRef_AsPyObjectSteal(value));
             UNLOCK_OBJECT(dict);
             // old_value should be DECREFed after GC track checking is done, if not, it could raise a segmentation fault,
@@ -3178,6 +3332,137 @@
             break;
         }
 
+        case _COMPARE_OP_INT_FLOAT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            PyObject *int_o;
+            double dleft, dright;
+            if (PyFloat_CheckExact(left_o)) {
+                int_o = right_o;
+                if (!PyLong_CheckExact(int_o)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                if (!_PyLong_IsCompact((PyLongObject *)int_o)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                dleft = PyFloat_AS_DOUBLE(left_o);
+                dright = (double)_PyLong_CompactValue((PyLongObject *)int_o);
+            }
+            else {
+                int_o = left_o;
+                if (!PyLong_CheckExact(int_o)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                if (!PyFloat_CheckExact(right_o)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                if (!_PyLong_IsCompact((PyLongObject *)int_o)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                dleft = (double)_PyLong_CompactValue((PyLongObject *)int_o);
+                dright = PyFloat_AS_DOUBLE(right_o);
+            }
+            STAT_INC(COMPARE_OP, hit);
+            // Compact ints are exactly representable as doubles
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_BYTES: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyBytes_CheckExact(left_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyBytes_CheckExact(right_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int eq = _PyBytes_Equal(left_o, right_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_TUPLE: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyTuple_CheckExact(left_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyTuple_CheckExact(right_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = _PyTuple_RichCompare(left_o, right_o, oparg >> 5);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            if (oparg & 16) {
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                int res_bool = PyObject_IsTrue(res_o);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                Py_DECREF(res_o);
+                if (res_bool < 0) JUMP_TO_ERROR();
+                res = res_bool ? PyStackRef_True : PyStackRef_False;
+            }
+            else {
+                res = PyStackRef_FromPyObjectSteal(res_o);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+            }
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _IS_OP: {
             _PyStackRef right;
             _PyStackRef left;
@@ -3272,26 +3557,53 @@
             break;
         }
 
-        case _CHECK_EG_MATCH: {
-            _PyStackRef match_type_st;
-            _PyStackRef exc_value_st;
-            _PyStackRef rest;
-            _PyStackRef match;
-            match_type_st = stack_pointer[-1];
-            exc_value_st = stack_pointer[-2];
-            PyObject *exc_value = PyStackRef_AsPyObjectBorrow(exc_value_st);
-            PyObject *match_type = PyStackRef_AsPyObjectBorrow(match_type_st);
-            _PyFrame_SetStackPointer(frame, stack_pointer);
-            int err = _PyEval_CheckExceptStarTypeValid(tstate, match_type);
-            stack_pointer = _PyFrame_GetStackPointer(frame);
-            if (err < 0) {
-                PyStackRef_CLOSE(exc_value_st);
-                PyStackRef_CLOSE(match_type_st);
-                if (true) JUMP_TO_ERROR();
-            }
-            PyObject *match_o = NULL;
-            PyObject *rest_o = NULL;
-            _PyFrame_SetStackPointer(frame, stack_pointer);
+        case _CONTAINS_OP_TUPLE: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyTuple_CheckExact(right_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(CONTAINS_OP, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int res = _PyTuple_Contains(right_o, left_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            if (res < 0) JUMP_TO_ERROR();
+            b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[-2] = b;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _CHECK_EG_MATCH: {
+            _PyStackRef match_type_st;
+            _PyStackRef exc_value_st;
+            _PyStackRef rest;
+            _PyStackRef match;
+            match_type_st = stack_pointer[-1];
+            exc_value_st = stack_pointer[-2];
+            PyObject *exc_value = PyStackRef_AsPyObjectBorrow(exc_value_st);
+            PyObject *match_type = PyStackRef_AsPyObjectBorrow(match_type_st);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int err = _PyEval_CheckExceptStarTypeValid(tstate, match_type);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (err < 0) {
+                PyStackRef_CLOSE(exc_value_st);
+                PyStackRef_CLOSE(match_type_st);
+                if (true) JUMP_TO_ERROR();
+            }
+            PyObject *match_o = NULL;
+            PyObject *rest_o = NULL;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
             int res = _PyEval_ExceptionGroupMatch(exc_value, match_type,
                 &match_o, &rest_o);
             stack_pointer = _PyFrame_GetStackPointer(frame);
@@ -3763,6 +4075,146 @@
             break;
         }
 
+        case _ITER_CHECK_DICT_ITEMS: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyDictIterItem_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _ITER_CHECK_ENUMERATE: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyEnum_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _ITER_CHECK_ZIP: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(iter_o) != &PyZip_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!_PyZip_IsPair(iter_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _FOR_ITER_DICT_ITEMS_UNPACKED: {
+            _PyStackRef iter;
+            _PyStackRef value;
+            _PyStackRef key;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *key_o, *value_o;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int ok = _PyDictIter_NextItem(iter_o, &key_o, &value_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    JUMP_TO_ERROR();
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            value = PyStackRef_FromPyObjectSteal(value_o);
+            key = PyStackRef_FromPyObjectSteal(key_o);
+            stack_pointer[0] = value;
+            stack_pointer[1] = key;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FOR_ITER_ENUMERATE_UNPACKED: {
+            _PyStackRef iter;
+            _PyStackRef item;
+            _PyStackRef index;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *index_o, *item_o;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int ok = _PyEnum_NextPair(iter_o, &index_o, &item_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    if (!matches) {
+                        JUMP_TO_ERROR();
+                    }
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            item = PyStackRef_FromPyObjectSteal(item_o);
+            index = PyStackRef_FromPyObjectSteal(index_o);
+            stack_pointer[0] = item;
+            stack_pointer[1] = index;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FOR_ITER_ZIP_UNPACKED: {
+            _PyStackRef iter;
+            _PyStackRef second;
+            _PyStackRef first;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            PyObject *first_o, *second_o;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int ok = _PyZip_NextPair(iter_o, &first_o, &second_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (!ok) {
+                if (_PyErr_Occurred(tstate)) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    if (!matches) {
+                        JUMP_TO_ERROR();
+                    }
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            second = PyStackRef_FromPyObjectSteal(second_o);
+            first = PyStackRef_FromPyObjectSteal(first_o);
+            stack_pointer[0] = second;
+            stack_pointer[1] = first;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _LOAD_SPECIAL: {
             _PyStackRef owner;
             _PyStackRef attr;
@@ -5460,6 +5912,140 @@
             break;
         }
 
+        case _CALL_KW_BUILTIN_FAST: {
+            _PyStackRef kwnames;
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef *callable;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            kwnames = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = &stack_pointer[-2 - oparg];
+            callable = &stack_pointer[-3 - oparg];
+            /* Builtin METH_FASTCALL | METH_KEYWORDS functions */
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            if (!PyCFunction_CheckExact(callable_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (PyCFunction_GET_FLAGS(callable_o) != (METH_FASTCALL | METH_KEYWORDS)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(CALL_KW, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyCFunctionFastWithKeywords cfunc =
+            (PyCFunctionFastWithKeywords)(void(*)(void))
+            PyCFunction_GET_FUNCTION(callable_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                PyStackRef_CLOSE(callable[0]);
+                PyStackRef_CLOSE(self_or_null[0]);
+                for (int _i = oparg; --_i >= 0;) {
+                    PyStackRef_CLOSE(args[_i]);
+                }
+                PyStackRef_CLOSE(kwnames);
+                if (true) JUMP_TO_ERROR();
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = cfunc(PyCFunction_GET_SELF(callable_o), args_o,
+                                    positional_args, kwnames_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+            PyStackRef_CLOSE(kwnames);
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            PyStackRef_CLOSE(callable[0]);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST: {
+            _PyStackRef kwnames;
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef *callable;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            kwnames = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = &stack_pointer[-2 - oparg];
+            callable = &stack_pointer[-3 - oparg];
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            if (positional_args == 0) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+            if (!Py_IS_TYPE(method, &PyMethodDescr_Type)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyMethodDef *meth = method->d_method;
+            if (meth->ml_flags != (METH_FASTCALL|METH_KEYWORDS)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *d_type = method->d_common.d_type;
+            PyObject *self = PyStackRef_AsPyObjectBorrow(args[0]);
+            if (!Py_IS_TYPE(self, d_type)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(CALL_KW, hit);
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                PyStackRef_CLOSE(callable[0]);
+                PyStackRef_CLOSE(self_or_null[0]);
+                for (int _i = oparg; --_i >= 0;) {
+                    PyStackRef_CLOSE(args[_i]);
+                }
+                PyStackRef_CLOSE(kwnames);
+                if (true) JUMP_TO_ERROR();
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyCFunctionFastWithKeywords cfunc =
+            (PyCFunctionFastWithKeywords)(void(*)(void))meth->ml_meth;
+            PyObject *res_o = cfunc(self, (args_o + 1), positional_args - 1,
+                                    kwnames_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+            PyStackRef_CLOSE(kwnames);
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            PyStackRef_CLOSE(callable[0]);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         /* _INSTRUMENTED_CALL_FUNCTION_EX is not a viable micro-op for tier 2 because it is instrumented */
 
         case _MAKE_CALLARGS_A_TUPLE: {
@@ -5500,6 +6086,51 @@
 
         /* _DO_CALL_FUNCTION_EX is not a viable micro-op for tier 2 because it uses the 'this_instr' variable */
 
+        case _CHECK_IS_NOT_PY_CALLABLE_EX: {
+            _PyStackRef func;
+            oparg = CURRENT_OPARG();
+            func = stack_pointer[-3 - (oparg & 1)];
+            if (PyFunction_Check(PyStackRef_AsPyObjectBorrow(func))) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CALL_FUNCTION_EX_NON_PY: {
+            _PyStackRef kwargs_st = PyStackRef_NULL;
+            _PyStackRef callargs_st;
+            _PyStackRef func_st;
+            _PyStackRef result;
+            oparg = CURRENT_OPARG();
+            if (oparg & 1) { kwargs_st = stack_pointer[-(oparg & 1)]; }
+            callargs_st = stack_pointer[-1 - (oparg & 1)];
+            func_st = stack_pointer[-3 - (oparg & 1)];
+            /* Vectorcall-capable callables other than Python functions.
+             * The tuple items are passed directly, and a non-empty kwargs
+             * dict is unpacked into keyword names by the callee's vectorcall. */
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_st);
+            PyObject *callargs = PyStackRef_AsPyObjectBorrow(callargs_st);
+            assert(PyTuple_CheckExact(callargs));
+            PyObject *kwargs = PyStackRef_AsPyObjectBorrow(kwargs_st);
+            assert(kwargs == NULL || PyDict_CheckExact(kwargs));
+            STAT_INC(CALL_FUNCTION_EX, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *result_o = PyObject_VectorcallDict(
+                func, _PyTuple_ITEMS(callargs), PyTuple_GET_SIZE(callargs),
+                kwargs);
+            PyStackRef_XCLOSE(kwargs_st);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            PyStackRef_CLOSE(callargs_st);
+            PyStackRef_CLOSE(func_st);
+            if (result_o == NULL) JUMP_TO_ERROR();
+            result = PyStackRef_FromPyObjectSteal(result_o);
+            stack_pointer[-3 - (oparg & 1)] = result;
+            stack_pointer += -2 - (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _MAKE_FUNCTION: {
             _PyStackRef codeobj_st;
             _PyStackRef func;
@@ -5820,13 +6451,14 @@
         case _EXIT_TRACE: {
             PyObject *exit_p = (PyObject *)CURRENT_OPERAND0();
             _PyExitData *exit = (_PyExitData *)exit_p;
+            exit->taken++;
             PyCodeObject *code = _PyFrame_GetCode(frame);
             _PyFrame_SetStackPointer(frame, stack_pointer);
             _Py_CODEUNIT *target = _PyFrame_GetBytecode(frame) + exit->target;
             stack_pointer = _PyFrame_GetStackPointer(frame);
             #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
-            if (lltrace >= 2) {
+            if (frame->lltrace >= 2) {
                 _PyFrame_SetStackPointer(frame, stack_pointer);
                 printf("SIDE EXIT: [UOp ");
                 _PyUOpPrint(&next_uop[-1]);
@@ -5842,18 +6474,21 @@
                 Py_CLEAR(exit->executor);
             }
             if (exit->executor == NULL) {
-                _Py_BackoffCounter temperature = exit->temperature;
-                if (!backoff_counter_triggers(temperature)) {
-                    exit->temperature = advance_backoff_counter(temperature);
-                    tstate->previous_executor = (PyObject *)current_executor;
-                    GOTO_TIER_ONE(target);
-                }
                 _PyExecutorObject *executor;
                 if (target->op.code == ENTER_EXECUTOR) {
+                    /* The target already has a trace: link to it straight
+                     * away rather than bouncing through tier one while
+                     * this exit warms up. */
                     executor = code->co_executors->executors[target->op.arg];
                     Py_INCREF(executor);
                 }
                 else {
+                    _Py_BackoffCounter temperature = exit->temperature;
+                    if (!backoff_counter_triggers(temperature)) {
+                        exit->temperature = advance_backoff_counter(temperature);
+                        tstate->previous_executor = (PyObject *)current_executor;
+                        GOTO_TIER_ONE(target);
+                    }
                     int chain_depth = current_executor->vm_data.chain_depth + 1;
                     _PyFrame_SetStackPointer(frame, stack_pointer);
                     int optimized = _PyOptimizer_Optimize(frame, target, stack_pointer, &executor, chain_depth);
@@ -5917,6 +6552,113 @@
             break;
         }
 
+        case _ENTER_INLINED: {
+            _PyStackRef *args;
+            _PyStackRef self_or_null;
+            _PyStackRef callable;
+            _PyStackRef self_or_null_out;
+            oparg = CURRENT_OPARG();
+            args = &stack_pointer[-oparg];
+            self_or_null = stack_pointer[-1 - oparg];
+            callable = stack_pointer[-2 - oparg];
+            /* The function has already been checked and is not needed.
+             * Dropping it leaves room for the inlined body's values. */
+            PyStackRef_CLOSE(callable);
+            self_or_null_out = self_or_null;
+            for (int i = 0; i < oparg; i++) {
+                args[i - 1] = args[i];
+            }
+            stack_pointer[-2 - oparg] = self_or_null_out;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _RETURN_INLINED: {
+            _PyStackRef retval;
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            retval = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = &stack_pointer[-2 - oparg];
+            _PyStackRef *arguments = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                arguments--;
+                total_args++;
+            }
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(arguments[i]);
+            }
+            res = retval;
+            stack_pointer[-2 - oparg] = res;
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ENTER_GUARDED_INLINED: {
+            break;
+        }
+
+        case _RETURN_GUARDED_INLINED: {
+            _PyStackRef retval;
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef callable;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            retval = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = &stack_pointer[-2 - oparg];
+            callable = stack_pointer[-3 - oparg];
+            _PyStackRef *arguments = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                arguments--;
+                total_args++;
+            }
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(arguments[i]);
+            }
+            PyStackRef_CLOSE(callable);
+            res = retval;
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _MATERIALIZE_INLINED_FRAME: {
+            oparg = CURRENT_OPARG();
+            uint16_t level = (uint16_t)CURRENT_OPERAND0();
+            uint32_t call_target = (uint32_t)CURRENT_OPERAND1();
+            PyCodeObject *code = _PyFrame_GetCode(frame);
+            _PyStackRef *callable = frame->localsplus + code->co_nlocalsplus + level;
+            _PyStackRef *args = callable + 2;
+            int has_self = !PyStackRef_IsNull(callable[1]);
+            _PyInterpreterFrame *new_frame = _PyFrame_PushUnchecked(tstate, callable[0], oparg + has_self, frame);
+            _PyStackRef *first_non_self_local = new_frame->localsplus + has_self;
+            new_frame->localsplus[0] = callable[1];
+            for (int i = 0; i < oparg; i++) {
+                first_non_self_local[i] = args[i];
+            }
+            for (_PyStackRef *value = args + oparg; value < stack_pointer; value++) {
+                _PyFrame_StackPush(new_frame, *value);
+            }
+            frame->instr_ptr = _PyCode_CODE(code) + call_target;
+            frame->return_offset = 1 + INLINE_CACHE_ENTRIES_CALL;
+            _PyFrame_SetStackPointer(frame, callable);
+            CALL_STAT_INC(inlined_py_calls);
+            frame = tstate->current_frame = new_frame;
+            tstate->py_recursion_remaining--;
+            LOAD_SP();
+            LLTRACE_RESUME_FRAME();
+            break;
+        }
+
         case _LOAD_CONST_INLINE_WITH_NULL: {
             _PyStackRef value;
             _PyStackRef null;
@@ -5954,6 +6696,23 @@
             break;
         }
 
+        case _GUARD_LOCAL_TYPE_VERSION: {
+            oparg = CURRENT_OPARG();
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            _PyStackRef value = GETLOCAL(oparg);
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(value));
+            assert(type_version != 0);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
         case _LOAD_GLOBAL_MODULE: {
             _PyStackRef res;
             _PyStackRef null = PyStackRef_NULL;
@@ -6041,10 +6800,11 @@
             PyObject *exit_p = (PyObject *)CURRENT_OPERAND0();
             tstate->previous_executor = (PyObject *)current_executor;
             _PyExitData *exit = (_PyExitData *)exit_p;
+            exit->taken++;
             _Py_CODEUNIT *target = frame->instr_ptr;
             #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
-            if (lltrace >= 2) {
+            if (frame->lltrace >= 2) {
                 _PyFrame_SetStackPointer(frame, stack_pointer);
                 printf("DYNAMIC EXIT: [UOp ");
                 _PyUOpPrint(&next_uop[-1]);
@@ -6092,6 +6852,7 @@
             current_executor = (_PyExecutorObject*)executor;
             #endif
             assert(((_PyExecutorObject *)executor)->vm_data.valid);
+            ((_PyExecutorObject *)executor)->vm_data.entries++;
             break;
         }
 
@@ -6121,6 +6882,7 @@
         }
 
         case _DEOPT: {
+            current_executor->vm_data.deopts++;
             EXIT_TO_TIER1();
             break;
         }
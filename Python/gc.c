@@ -6,12 +6,16 @@
 #include "pycore_ceval.h"         // _Py_set_eval_breaker_bit()
 #include "pycore_context.h"
 #include "pycore_dict.h"          // _PyInlineValuesSize()
+#include "pycore_hashtable.h"     // _Py_hashtable_t
 #include "pycore_initconfig.h"
 #include "pycore_interp.h"        // PyInterpreterState.gc
+#include "pycore_lock.h"          // _Py_yield()
 #include "pycore_object.h"
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
 #include "pydtrace.h"
 
@@ -57,6 +61,19 @@ typedef struct _gc_runtime_state GCState;
 // Automatically choose the generation that needs collecting.
 #define GENERATION_AUTO (-1)
 
+// State of the background marking thread, see "Background marking" below.
+struct _gc_background_marker {
+    PyInterpreterState *interp;
+    int stop;
+    // Set when there is new marking to do: after each increment.
+    int requested;
+    // Bumped whenever the thread should wake up. It parks on it while
+    // there is nothing to do.
+    uint32_t wakeups;
+    bool started;
+    PyThread_handle_t handle;
+};
+
 static inline int
 gc_is_collecting(PyGC_Head *g)
 {
@@ -168,6 +185,8 @@ _PyGC_InitState(GCState *gcstate)
     INIT_HEAD(gcstate->permanent_generation);
 
 #undef INIT_HEAD
+    gcstate->background_reachable._gc_next = (uintptr_t)&gcstate->background_reachable;
+    gcstate->background_reachable._gc_prev = (uintptr_t)&gcstate->background_reachable;
 }
 
 
@@ -187,6 +206,20 @@ _PyGC_Init(PyInterpreterState *interp)
     }
     gcstate->heap_size = 0;
 
+    // Subinterpreters may be finalized after the runtime, when the thread
+    // could no longer take the GIL to exit, so only the main interpreter
+    // marks in the background.
+    char *env = Py_GETENV("PYTHON_GC_BACKGROUND_MARK");
+    if (env && *env != '\0' && *env != '0' && _Py_IsMainInterpreter(interp)) {
+        struct _gc_background_marker *marker =
+            PyMem_RawCalloc(1, sizeof(struct _gc_background_marker));
+        if (marker == NULL) {
+            return _PyStatus_NO_MEMORY();
+        }
+        marker->interp = interp;
+        gcstate->background_marker = marker;
+    }
+
     return _PyStatus_OK();
 }
 
@@ -1253,6 +1286,54 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     gc_list_merge(resurrected, old_generation);
 }
 
+/* Per-type statistics (DEBUG_TYPE_STATS).
+ * The table holds borrowed references to the types.  type_dealloc() removes
+ * a type's entry (see _PyGC_RemoveTypeStats()), so the statistics of a
+ * type go away with it.  Recording is best effort: objects are not counted
+ * if memory is exhausted.
+ */
+
+static struct gc_type_stats *
+get_type_stats(GCState *gcstate, PyTypeObject *tp)
+{
+    if (gcstate->type_stats == NULL) {
+        gcstate->type_stats = _Py_hashtable_new_full(
+            _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+            NULL, PyMem_RawFree, NULL);
+        if (gcstate->type_stats == NULL) {
+            return NULL;
+        }
+    }
+    struct gc_type_stats *st = _Py_hashtable_get(gcstate->type_stats, tp);
+    if (st == NULL) {
+        st = PyMem_RawCalloc(1, sizeof(struct gc_type_stats));
+        if (st == NULL) {
+            return NULL;
+        }
+        if (_Py_hashtable_set(gcstate->type_stats, tp, st) < 0) {
+            PyMem_RawFree(st);
+            return NULL;
+        }
+    }
+    return st;
+}
+
+/* Add the objects in list to the counts of their types. */
+static void
+add_type_stats(GCState *gcstate, PyGC_Head *list,
+               int traversed, int survived, int collected)
+{
+    PyGC_Head *gc;
+    for (gc = GC_NEXT(list); gc != list; gc = GC_NEXT(gc)) {
+        struct gc_type_stats *st = get_type_stats(gcstate, Py_TYPE(FROM_GC(gc)));
+        if (st != NULL) {
+            st->traversed += traversed;
+            st->survived += survived;
+            st->collected += collected;
+        }
+    }
+}
+
 static void
 gc_collect_region(PyThreadState *tstate,
                   PyGC_Head *from,
@@ -1440,33 +1521,50 @@ move_to_reachable(PyObject *op, PyGC_Head *reachable, int visited_space)
 }
 
 static intptr_t
-mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
+mark_some_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space,
+                    Py_ssize_t max_traversed)
 {
-    // Transitively traverse all objects from reachable, until empty
+    // Transitively traverse objects from reachable, until empty or
+    // max_traversed objects have been traversed
     struct container_and_flag arg = {
         .container = reachable,
         .visited_space = visited_space,
         .size = 0
     };
-    while (!gc_list_is_empty(reachable)) {
+    GCState *gcstate = get_gc_state();
+    int type_stats = gcstate->debug & _PyGC_DEBUG_TYPE_STATS;
+    while (!gc_list_is_empty(reachable) && max_traversed-- > 0) {
         PyGC_Head *gc = _PyGCHead_NEXT(reachable);
         assert(gc_old_space(gc) == visited_space);
         gc_list_move(gc, visited);
         PyObject *op = FROM_GC(gc);
+        if (type_stats) {
+            struct gc_type_stats *st = get_type_stats(gcstate, Py_TYPE(op));
+            if (st != NULL) {
+                st->traversed++;
+            }
+        }
         traverseproc traverse = Py_TYPE(op)->tp_traverse;
         (void) traverse(op,
                         visit_add_to_container,
                         &arg);
     }
-    gc_list_validate_space(visited, visited_space);
     return arg.size;
 }
 
 static intptr_t
-mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, bool start)
+mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
+{
+    intptr_t objects_marked = mark_some_reachable(reachable, visited, visited_space,
+                                                  PY_SSIZE_T_MAX);
+    gc_list_validate_space(visited, visited_space);
+    return objects_marked;
+}
+
+static intptr_t
+move_stacks_to_reachable(PyInterpreterState *interp, PyGC_Head *reachable,
+                         int visited_space, bool start)
 {
-    PyGC_Head reachable;
-    gc_list_init(&reachable);
     Py_ssize_t objects_marked = 0;
     // Move all objects on stacks to reachable
     _PyRuntimeState *runtime = &_PyRuntime;
@@ -1482,9 +1580,9 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
             }
             _PyStackRef *locals = frame->localsplus;
             _PyStackRef *sp = frame->stackpointer;
-            objects_marked += move_to_reachable(frame->f_locals, &reachable, visited_space);
+            objects_marked += move_to_reachable(frame->f_locals, reachable, visited_space);
             PyObject *func = PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
-            objects_marked += move_to_reachable(func, &reachable, visited_space);
+            objects_marked += move_to_reachable(func, reachable, visited_space);
             while (sp > locals) {
                 sp--;
                 if (PyStackRef_IsNull(*sp)) {
@@ -1497,7 +1595,7 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
                         gc_old_space(gc) != visited_space) {
                         gc_flip_old_space(gc);
                         objects_marked++;
-                        gc_list_move(gc, &reachable);
+                        gc_list_move(gc, reachable);
                     }
                 }
             }
@@ -1513,29 +1611,45 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
         ts = PyThreadState_Next(ts);
         HEAD_UNLOCK(runtime);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
-    assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
 static intptr_t
-mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_space)
+mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, bool start)
 {
     PyGC_Head reachable;
     gc_list_init(&reachable);
+    Py_ssize_t objects_marked = move_stacks_to_reachable(interp, &reachable, visited_space, start);
+    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
+    assert(gc_list_is_empty(&reachable));
+    return objects_marked;
+}
+
+static intptr_t
+move_global_roots_to_reachable(PyInterpreterState *interp, PyGC_Head *reachable, int visited_space)
+{
     Py_ssize_t objects_marked = 0;
-    objects_marked += move_to_reachable(interp->sysdict, &reachable, visited_space);
-    objects_marked += move_to_reachable(interp->builtins, &reachable, visited_space);
-    objects_marked += move_to_reachable(interp->dict, &reachable, visited_space);
+    objects_marked += move_to_reachable(interp->sysdict, reachable, visited_space);
+    objects_marked += move_to_reachable(interp->builtins, reachable, visited_space);
+    objects_marked += move_to_reachable(interp->dict, reachable, visited_space);
     struct types_state *types = &interp->types;
     for (int i = 0; i < _Py_MAX_MANAGED_STATIC_BUILTIN_TYPES; i++) {
-        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_dict, &reachable, visited_space);
-        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_subclasses, &reachable, visited_space);
+        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_dict, reachable, visited_space);
+        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_subclasses, reachable, visited_space);
     }
     for (int i = 0; i < _Py_MAX_MANAGED_STATIC_EXT_TYPES; i++) {
-        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, &reachable, visited_space);
-        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, &reachable, visited_space);
+        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, reachable, visited_space);
+        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, reachable, visited_space);
     }
+    return objects_marked;
+}
+
+static intptr_t
+mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_space)
+{
+    PyGC_Head reachable;
+    gc_list_init(&reachable);
+    Py_ssize_t objects_marked = move_global_roots_to_reachable(interp, &reachable, visited_space);
     objects_marked += mark_all_reachable(&reachable, visited, visited_space);
     assert(gc_list_is_empty(&reachable));
     return objects_marked;
@@ -1584,6 +1698,168 @@ assess_work_to_do(GCState *gcstate)
     return new_objects + heap_fraction;
 }
 
+// Background marking
+// ==================
+//
+// With PYTHON_GC_BACKGROUND_MARK set, the transitive marking of the old
+// generation moves off the allocating thread. The increments only move the
+// roots (the global roots at the start of a scavenge, the thread stacks in
+// every increment) to gcstate->background_reachable, and traverse at most
+// their own budget of it. A helper thread does the rest: it has a thread
+// state of its own, marks only while holding the GIL, and gives the GIL
+// back after every BACKGROUND_MARK_STEP objects, so it mostly runs while
+// the other threads wait for I/O. Everything it marks is subtracted from
+// work_to_do. Until background_reachable is empty, increments don't scan
+// the old generation, which would pull in the objects still to be marked.
+// Anything that walks the old generation first moves the objects left in
+// background_reachable to the visited space, untraversed.
+//
+// No write barrier is needed. Marking only decides which objects the
+// increments of the current scavenge leave alone; an increment finds
+// garbage by comparing reference counts, and treats anything referenced
+// from outside the increment as reachable. A reference stored into an
+// object that has already been traversed keeps its target alive until an
+// increment scans it, as it does with the inline marking. Objects that
+// become garbage after being marked survive until the next scavenge.
+
+#define BACKGROUND_MARK_STEP 1000
+
+static void
+flush_background_marking(GCState *gcstate)
+{
+    gc_list_merge(&gcstate->background_reachable,
+                  &gcstate->old[gcstate->visited_space].head);
+}
+
+/* Starts the marking of a new scavenge: the roots are marked, and their
+ * referents are left for the background thread. */
+static intptr_t
+mark_roots_in_background(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head *reachable = &gcstate->background_reachable;
+    int visited_space = gcstate->visited_space;
+    intptr_t objects_marked = move_global_roots_to_reachable(interp, reachable, visited_space);
+    objects_marked += move_stacks_to_reachable(interp, reachable, visited_space, true);
+    gcstate->phase = GC_PHASE_COLLECT;
+    return objects_marked;
+}
+
+/* Does one step of background marking. Returns 1 if there is more to do. */
+static int
+background_mark_step(struct _gc_background_marker *marker)
+{
+    PyInterpreterState *interp = marker->interp;
+    GCState *gcstate = &interp->gc;
+    // A collection that runs finalizers may have released the GIL.
+    if (!gcstate->enabled || _Py_atomic_load_int_relaxed(&gcstate->collecting)) {
+        _Py_atomic_store_int(&marker->requested, 0);
+        return 0;
+    }
+    int visited_space = gcstate->visited_space;
+    PyGC_Head *reachable = &gcstate->background_reachable;
+    intptr_t objects_marked = 0;
+    if (gcstate->phase == GC_PHASE_MARK) {
+        objects_marked += mark_roots_in_background(interp);
+    }
+    if (gc_list_is_empty(reachable)) {
+        _Py_atomic_store_int(&marker->requested, 0);
+        return 0;
+    }
+    objects_marked += mark_some_reachable(reachable, &gcstate->old[visited_space].head,
+                                          visited_space, BACKGROUND_MARK_STEP);
+    GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
+    gcstate->work_to_do -= objects_marked;
+    return 1;
+}
+
+static void
+background_marker_main(void *arg)
+{
+    struct _gc_background_marker *marker = (struct _gc_background_marker *)arg;
+    PyThreadState *tstate = PyThreadState_New(marker->interp);
+    if (tstate == NULL) {
+        return;
+    }
+    for (;;) {
+        uint32_t wakeups = _Py_atomic_load_uint32(&marker->wakeups);
+        if (_Py_atomic_load_int(&marker->stop)) {
+            break;
+        }
+        if (!_Py_atomic_load_int(&marker->requested)) {
+            _PyParkingLot_Park(&marker->wakeups, &wakeups, sizeof(wakeups),
+                               -1, NULL, 0);
+            continue;
+        }
+        PyEval_RestoreThread(tstate);
+        while (!_Py_atomic_load_int(&marker->stop) && background_mark_step(marker)) {
+            // Let the other threads have the GIL between steps
+            PyEval_SaveThread();
+            _Py_yield();
+            PyEval_RestoreThread(tstate);
+        }
+        PyEval_SaveThread();
+    }
+    PyEval_RestoreThread(tstate);
+    PyThreadState_Clear(tstate);
+    PyThreadState_DeleteCurrent();
+}
+
+static void
+wake_background_marker(GCState *gcstate)
+{
+    struct _gc_background_marker *marker = gcstate->background_marker;
+    if (marker == NULL) {
+        return;
+    }
+    if (!marker->started) {
+        // If the thread can't be started, the marking stays inline.
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(background_marker_main, marker,
+                                           &ident, &marker->handle)) {
+            return;
+        }
+        marker->started = true;
+    }
+    _Py_atomic_store_int(&marker->requested, 1);
+    _Py_atomic_add_uint32(&marker->wakeups, 1);
+    _PyParkingLot_UnparkAll(&marker->wakeups);
+}
+
+void
+_PyGC_FiniBackgroundMarking(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    struct _gc_background_marker *marker = gcstate->background_marker;
+    if (marker == NULL) {
+        return;
+    }
+    gcstate->background_marker = NULL;
+    if (marker->started) {
+        _Py_atomic_store_int(&marker->stop, 1);
+        _Py_atomic_add_uint32(&marker->wakeups, 1);
+        _PyParkingLot_UnparkAll(&marker->wakeups);
+        // The thread needs the GIL to delete its thread state
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_join_thread(marker->handle);
+        Py_END_ALLOW_THREADS
+    }
+    PyMem_RawFree(marker);
+    flush_background_marking(gcstate);
+}
+
+void
+_PyGC_AfterForkBackgroundMarking(PyInterpreterState *interp)
+{
+    struct _gc_background_marker *marker = interp->gc.background_marker;
+    if (marker == NULL) {
+        return;
+    }
+    // The thread (and its thread state) didn't survive the fork. A new one
+    // is started after the next increment.
+    marker->started = false;
+}
+
 static void
 gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
 {
@@ -1591,6 +1867,11 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     GCState *gcstate = &tstate->interp->gc;
     gcstate->work_to_do += assess_work_to_do(gcstate);
     untrack_tuples(&gcstate->young.head);
+    if (gcstate->phase == GC_PHASE_MARK && gcstate->background_marker != NULL) {
+        intptr_t objects_marked = mark_roots_in_background(tstate->interp);
+        GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
+        gcstate->work_to_do -= objects_marked;
+    }
     if (gcstate->phase == GC_PHASE_MARK) {
         Py_ssize_t objects_marked = mark_at_start(tstate);
         GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
@@ -1606,14 +1887,30 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (scale_factor < 2) {
         scale_factor = 2;
     }
-    intptr_t objects_marked = mark_stacks(tstate->interp, visited, gcstate->visited_space, false);
+    PyGC_Head *background_reachable = &gcstate->background_reachable;
+    intptr_t objects_marked;
+    if (gcstate->background_marker != NULL) {
+        // Share the transitive marking with the background thread, within
+        // the budget of this increment.
+        objects_marked = move_stacks_to_reachable(tstate->interp, background_reachable,
+                                                  gcstate->visited_space, false);
+        objects_marked += mark_some_reachable(background_reachable, visited, gcstate->visited_space,
+                                              gcstate->work_to_do - objects_marked);
+    }
+    else {
+        objects_marked = mark_stacks(tstate->interp, visited, gcstate->visited_space, false);
+    }
     GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
     gcstate->work_to_do -= objects_marked;
     gc_list_set_space(&gcstate->young.head, gcstate->visited_space);
     gc_list_merge(&gcstate->young.head, &increment);
     gc_list_validate_space(&increment, gcstate->visited_space);
     Py_ssize_t increment_size = gc_list_size(&increment);
-    while (increment_size < gcstate->work_to_do) {
+    // Objects still to be marked in the background may reach a large part
+    // of the old generation, so it isn't scanned until they are done.
+    while (increment_size < gcstate->work_to_do &&
+           gc_list_is_empty(background_reachable))
+    {
         if (gc_list_is_empty(not_visited)) {
             break;
         }
@@ -1637,9 +1934,11 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
 
     add_stats(gcstate, 1, stats);
     if (gc_list_is_empty(not_visited)) {
+        flush_background_marking(gcstate);
         completed_scavenge(gcstate);
     }
     validate_spaces(gcstate);
+    wake_background_marker(gcstate);
 }
 
 static void
@@ -1648,6 +1947,7 @@ gc_collect_full(PyThreadState *tstate,
 {
     GC_STAT_ADD(2, collections, 1);
     GCState *gcstate = &tstate->interp->gc;
+    flush_background_marking(gcstate);
     validate_spaces(gcstate);
     PyGC_Head *young = &gcstate->young.head;
     PyGC_Head *pending = &gcstate->old[gcstate->visited_space^1].head;
@@ -1689,8 +1989,15 @@ gc_collect_region(PyThreadState *tstate,
     assert(gcstate->garbage != NULL);
     assert(!_PyErr_Occurred(tstate));
 
+    int type_stats = gcstate->debug & _PyGC_DEBUG_TYPE_STATS;
+    if (type_stats) {
+        add_type_stats(gcstate, from, 1, 0, 0);
+    }
     gc_list_init(&unreachable);
     deduce_unreachable(from, &unreachable);
+    if (type_stats) {
+        add_type_stats(gcstate, from, 0, 1, 0);
+    }
     validate_consistent_old_space(from);
     untrack_tuples(from);
     validate_consistent_old_space(to);
@@ -1741,6 +2048,9 @@ gc_collect_region(PyThreadState *tstate,
     * in finalizers to be freed.
     */
     stats->collected += gc_list_size(&final_unreachable);
+    if (type_stats) {
+        add_type_stats(gcstate, &final_unreachable, 0, 0, 1);
+    }
     delete_garbage(tstate, gcstate, &final_unreachable, to);
 
     /* Collect statistics on uncollectable objects found and print
@@ -1862,6 +2172,7 @@ _PyGC_GetReferrers(PyInterpreterState *interp, PyObject *objs)
     }
 
     GCState *gcstate = &interp->gc;
+    flush_background_marking(gcstate);
     for (int i = 0; i < NUM_GENERATIONS; i++) {
         if (!(gc_referrers_for(objs, GEN_HEAD(gcstate, i), result))) {
             Py_DECREF(result);
@@ -1876,6 +2187,7 @@ _PyGC_GetObjects(PyInterpreterState *interp, int generation)
 {
     assert(generation >= -1 && generation < NUM_GENERATIONS);
     GCState *gcstate = &interp->gc;
+    flush_background_marking(gcstate);
 
     PyObject *result = PyList_New(0);
     /* Generation:
@@ -1907,10 +2219,80 @@ _PyGC_GetObjects(PyInterpreterState *interp, int generation)
     return NULL;
 }
 
+struct type_stats_entry {
+    PyTypeObject *type;
+    struct gc_type_stats stats;
+};
+
+static int
+copy_type_stats(_Py_hashtable_t *ht, const void *key, const void *value,
+                void *user_data)
+{
+    struct type_stats_entry **next = (struct type_stats_entry **)user_data;
+    (*next)->type = (PyTypeObject *)Py_NewRef((PyObject *)key);
+    (*next)->stats = *(const struct gc_type_stats *)value;
+    (*next)++;
+    return 0;
+}
+
+PyObject *
+_PyGC_GetTypeStats(PyInterpreterState *interp, int reset)
+{
+    GCState *gcstate = &interp->gc;
+    _Py_hashtable_t *table = gcstate->type_stats;
+    size_t n = table != NULL ? _Py_hashtable_len(table) : 0;
+
+    /* Copy the entries first: building the result may run a collection,
+     * which updates the table. */
+    struct type_stats_entry *entries = NULL;
+    if (n > 0) {
+        entries = PyMem_New(struct type_stats_entry, n);
+        if (entries == NULL) {
+            return PyErr_NoMemory();
+        }
+        struct type_stats_entry *next = entries;
+        _Py_hashtable_foreach(table, copy_type_stats, &next);
+    }
+    if (reset && table != NULL) {
+        gcstate->type_stats = NULL;
+        _Py_hashtable_destroy(table);
+    }
+
+    PyObject *result = PyDict_New();
+    for (size_t i = 0; i < n && result != NULL; i++) {
+        struct gc_type_stats *st = &entries[i].stats;
+        PyObject *value = Py_BuildValue("{snsnsn}",
+                                        "traversed", st->traversed,
+                                        "survived", st->survived,
+                                        "collected", st->collected);
+        if (value == NULL ||
+            PyDict_SetItem(result, (PyObject *)entries[i].type, value) < 0)
+        {
+            Py_CLEAR(result);
+        }
+        Py_XDECREF(value);
+    }
+    for (size_t i = 0; i < n; i++) {
+        Py_DECREF(entries[i].type);
+    }
+    PyMem_Free(entries);
+    return result;
+}
+
+void
+_PyGC_RemoveTypeStats(PyInterpreterState *interp, PyTypeObject *type)
+{
+    GCState *gcstate = &interp->gc;
+    if (gcstate->type_stats != NULL) {
+        PyMem_RawFree(_Py_hashtable_steal(gcstate->type_stats, type));
+    }
+}
+
 void
 _PyGC_Freeze(PyInterpreterState *interp)
 {
     GCState *gcstate = &interp->gc;
+    flush_background_marking(gcstate);
     /* The permanent_generation must be visited */
     gc_list_set_space(&gcstate->young.head, gcstate->visited_space);
     gc_list_merge(&gcstate->young.head, &gcstate->permanent_generation.head);
@@ -1946,6 +2328,108 @@ _PyGC_GetFreezeCount(PyInterpreterState *interp)
     return gc_list_size(&gcstate->permanent_generation.head);
 }
 
+/* Objects that can't be made immortal, or are already */
+static int
+skip_immortalize(PyObject *op)
+{
+    // Only interned strings may be immortal, and they are made immortal
+    // when they are interned.
+    return _Py_IsImmortal(op) || PyUnicode_Check(op);
+}
+
+static void
+immortalize_object(PyThreadState *tstate, PyObject *op)
+{
+#ifdef Py_REF_DEBUG
+    // Decrements of immortal objects aren't registered
+    _Py_AddRefTotal(tstate, -Py_REFCNT(op));
+#endif
+    _Py_SetImmortal(op);
+}
+
+struct immortalize_args {
+    PyThreadState *tstate;
+    int depth;
+    Py_ssize_t count;
+    Py_ssize_t gc_count;
+};
+
+/* Untracked containers are not in any generation, so they are made immortal
+ * when they are found from a tracked object.  The depth is limited to avoid
+ * a C stack overflow; the rest simply stays mortal. */
+#define IMMORTALIZE_MAX_DEPTH 100
+
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    struct immortalize_args *args = (struct immortalize_args *)arg;
+    if (skip_immortalize(op)) {
+        return 0;
+    }
+    if (PyObject_IS_GC(op)) {
+        if (_PyObject_GC_IS_TRACKED(op)
+            || args->depth >= IMMORTALIZE_MAX_DEPTH)
+        {
+            return 0;
+        }
+        immortalize_object(args->tstate, op);
+        args->count++;
+        args->gc_count++;
+        args->depth++;
+        (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, args);
+        args->depth--;
+        return 0;
+    }
+    immortalize_object(args->tstate, op);
+    args->count++;
+    return 0;
+}
+
+Py_ssize_t
+_PyGC_Immortalize(PyThreadState *tstate)
+{
+    GCState *gcstate = &tstate->interp->gc;
+
+    int expected = 0;
+    if (!_Py_atomic_compare_exchange_int(&gcstate->collecting, &expected, 1)) {
+        // Don't move objects out of the generations during a collection.
+        return 0;
+    }
+    flush_background_marking(gcstate);
+
+    PyGC_Head objects;
+    gc_list_init(&objects);
+    PyGC_Head *lists[] = {
+        &gcstate->young.head,
+        &gcstate->old[0].head,
+        &gcstate->old[1].head,
+        &gcstate->permanent_generation.head,
+    };
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(lists); i++) {
+        gc_list_set_space(lists[i], 0);
+        gc_list_merge(lists[i], &objects);
+    }
+    gcstate->young.count = 0;
+    gcstate->old[0].count = 0;
+    gcstate->old[1].count = 0;
+
+    struct immortalize_args args = {.tstate = tstate};
+    while (!gc_list_is_empty(&objects)) {
+        PyObject *op = FROM_GC(GC_NEXT(&objects));
+        // Untracks the object, removing it from the list
+        immortalize_object(tstate, op);
+        args.count++;
+        args.gc_count++;
+        (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, &args);
+    }
+    // Immortal objects are never freed
+    gcstate->heap_size -= args.gc_count;
+    validate_spaces(gcstate);
+
+    _Py_atomic_store_int(&gcstate->collecting, 0);
+    return args.count;
+}
+
 /* C API for controlling the state of the garbage collector */
 int
 PyGC_Enable(void)
@@ -2120,6 +2604,11 @@ _PyGC_Fini(PyInterpreterState *interp)
     GCState *gcstate = &interp->gc;
     Py_CLEAR(gcstate->garbage);
     Py_CLEAR(gcstate->callbacks);
+    if (gcstate->type_stats != NULL) {
+        _Py_hashtable_t *table = gcstate->type_stats;
+        gcstate->type_stats = NULL;
+        _Py_hashtable_destroy(table);
+    }
 
     /* Prevent a subtle bug that affects sub-interpreters that use basic
      * single-phase init extensions (m_size == -1).  Those extensions cause objects
@@ -2140,6 +2629,10 @@ _PyGC_Fini(PyInterpreterState *interp)
     finalize_unlink_gc_head(&gcstate->old[0].head);
     finalize_unlink_gc_head(&gcstate->old[1].head);
     finalize_unlink_gc_head(&gcstate->permanent_generation.head);
+    finalize_unlink_gc_head(&gcstate->background_reachable);
+    // Left if the interpreter wasn't finalized
+    PyMem_RawFree(gcstate->background_marker);
+    gcstate->background_marker = NULL;
 }
 
 /* for debugging */
@@ -2400,6 +2893,7 @@ PyUnstable_GC_VisitObjects(gcvisitobjects_t callback, void *arg)
     GCState *gcstate = get_gc_state();
     int origenstate = gcstate->enabled;
     gcstate->enabled = 0;
+    flush_background_marking(gcstate);
     if (visit_generation(callback, arg, &gcstate->young)) {
         goto done;
     }
@@ -5,14 +5,18 @@
 #include "pycore_context.h"
 #include "pycore_dict.h"          // _PyInlineValuesSize()
 #include "pycore_freelist.h"      // _PyObject_ClearFreeLists()
+#include "pycore_hashtable.h"     // _Py_hashtable_t
 #include "pycore_initconfig.h"
 #include "pycore_interp.h"        // PyInterpreterState.gc
+#include "pycore_lock.h"          // PyEvent
 #include "pycore_object.h"
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
 #include "pycore_object_stack.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
+#include "pycore_typeobject.h"    // _PyType_GetTraverseBase()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
 #include "pydtrace.h"
 #include "pycore_uniqueid.h"      // _PyObject_MergeThreadLocalRefcounts()
@@ -33,6 +37,17 @@ typedef struct _gc_runtime_state GCState;
 // Automatically choose the generation that needs collecting.
 #define GENERATION_AUTO (-1)
 
+// Parallel marking is only used if there are at least this many heap pages
+// for each thread, so that small heaps don't pay for starting threads.
+#define PARALLEL_MIN_PAGES_PER_THREAD 64
+
+// Number of heap pages a thread claims at a time in a parallel phase.
+#define PARALLEL_PAGES_PER_CLAIM 4
+
+// A thread marking objects shares its worklist with idle threads after
+// pushing this many objects.
+#define PARALLEL_SHARE_THRESHOLD 64
+
 // A linked list of objects using the `ob_tid` field as the next pointer.
 // The linked list pointers are distinct from any real thread ids, because the
 // thread ids returned by _Py_ThreadId() are also pointers to distinct objects.
@@ -56,6 +71,10 @@ struct collection_state {
     PyInterpreterState *interp;
     GCState *gcstate;
     _PyGC_Reason reason;
+    // Record per-type statistics (DEBUG_TYPE_STATS)
+    int type_stats;
+    // Counts recorded by the serial scan, see type_stats_merge()
+    struct _Py_hashtable_t *type_counts;
     Py_ssize_t collected;
     Py_ssize_t uncollectable;
     Py_ssize_t long_lived_total;
@@ -79,7 +98,7 @@ static void
 worklist_push(struct worklist *worklist, PyObject *op)
 {
     assert(op->ob_tid == 0);
-    op->ob_tid = worklist->head;
+    _Py_atomic_store_uintptr_relaxed(&op->ob_tid, worklist->head);
     worklist->head = (uintptr_t)op;
 }
 
@@ -290,8 +309,8 @@ op_from_block(void *block, void *arg, bool include_frozen)
 }
 
 static int
-gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor,
-                         struct visitor_args *arg)
+gc_visit_heaps_lock_held(PyInterpreterState *interp, bool visit_blocks,
+                         mi_block_visit_fun *visitor, struct visitor_args *arg)
 {
     // Offset of PyObject header from start of memory block.
     Py_ssize_t offset_base = 0;
@@ -312,12 +331,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
         }
 
         arg->offset = offset_base;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
         arg->offset = offset_pre;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
@@ -326,12 +345,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
     // visit blocks in the per-interpreter abandoned pool (from dead threads)
     mi_abandoned_pool_t *pool = &interp->mimalloc.abandoned_pool;
     arg->offset = offset_base;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
     arg->offset = offset_pre;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
@@ -351,7 +370,7 @@ gc_visit_heaps(PyInterpreterState *interp, mi_block_visit_fun *visitor,
 
     int err;
     HEAD_LOCK(&_PyRuntime);
-    err = gc_visit_heaps_lock_held(interp, visitor, arg);
+    err = gc_visit_heaps_lock_held(interp, true, visitor, arg);
     HEAD_UNLOCK(&_PyRuntime);
     return err;
 }
@@ -633,6 +652,89 @@ restore_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+// Per-type statistics (DEBUG_TYPE_STATS)
+// =======================================
+//
+// The tables map types (borrowed references) to struct gc_type_stats.
+// type_dealloc() removes a type's entry from the interpreter's table, see
+// _PyGC_RemoveTypeStats(). While the world is stopped, the scan counts
+// objects in tables of its own (one per thread when marking in parallel),
+// which are merged into the interpreter's table afterwards, so that
+// type_stats_mutex is only held briefly. The tables are allocated with
+// malloc(), since the parallel scan runs on threads without a thread
+// state. Recording is best effort: objects are not counted if memory is
+// exhausted.
+
+static _Py_hashtable_allocator_t type_stats_allocator = {malloc, free};
+
+// Return the counts for tp in *table, creating the table and the entry if
+// needed, or NULL on out-of-memory.
+static struct gc_type_stats *
+type_stats_get(struct _Py_hashtable_t **table, PyTypeObject *tp)
+{
+    if (*table == NULL) {
+        *table = _Py_hashtable_new_full(
+            _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+            NULL, free, &type_stats_allocator);
+        if (*table == NULL) {
+            return NULL;
+        }
+    }
+    struct gc_type_stats *st = _Py_hashtable_get(*table, tp);
+    if (st == NULL) {
+        st = calloc(1, sizeof(struct gc_type_stats));
+        if (st == NULL) {
+            return NULL;
+        }
+        if (_Py_hashtable_set(*table, tp, st) < 0) {
+            free(st);
+            return NULL;
+        }
+    }
+    return st;
+}
+
+// Count an object found by the scan.
+static void
+type_stats_count_scanned(struct _Py_hashtable_t **table, PyObject *op,
+                         int survived)
+{
+    struct gc_type_stats *st = type_stats_get(table, Py_TYPE(op));
+    if (st != NULL) {
+        st->traversed++;
+        st->survived += survived;
+    }
+}
+
+static int
+type_stats_merge_entry(_Py_hashtable_t *ht, const void *key,
+                       const void *value, void *user_data)
+{
+    const struct gc_type_stats *counts = value;
+    struct gc_type_stats *st = type_stats_get(user_data, (PyTypeObject *)key);
+    if (st != NULL) {
+        st->traversed += counts->traversed;
+        st->survived += counts->survived;
+        st->collected += counts->collected;
+    }
+    return 0;
+}
+
+// Add the counts of a scan to the interpreter's table and free them. Called
+// while the world is stopped, so the types are still alive.
+static void
+type_stats_merge(GCState *gcstate, struct _Py_hashtable_t *counts)
+{
+    if (counts == NULL) {
+        return;
+    }
+    PyMutex_LockFlags(&gcstate->type_stats_mutex, _Py_LOCK_DONT_DETACH);
+    _Py_hashtable_foreach(counts, type_stats_merge_entry,
+                          &gcstate->type_stats);
+    PyMutex_Unlock(&gcstate->type_stats_mutex);
+    _Py_hashtable_destroy(counts);
+}
+
 /* Return true if object has a pre-PEP 442 finalization method. */
 static int
 has_legacy_finalizer(PyObject *op)
@@ -640,6 +742,29 @@ has_legacy_finalizer(PyObject *op)
     return Py_TYPE(op)->tp_del != NULL;
 }
 
+// Move an object that is still marked as unreachable after marking to
+// either the unreachable or legacy finalizers worklist.
+static void
+scan_unreachable(struct collection_state *state, PyObject *op)
+{
+    // Disable deferred refcounting for unreachable objects so that they
+    // are collected immediately after finalization.
+    disable_deferred_refcounting(op);
+
+    // Merge and add one to the refcount to prevent deallocation while we
+    // are holding on to it in a worklist.
+    merge_refcount(op, 1);
+
+    if (has_legacy_finalizer(op)) {
+        // would be unreachable, but has legacy finalizer
+        gc_clear_unreachable(op);
+        worklist_push(&state->legacy_finalizers, op);
+    }
+    else {
+        worklist_push(&state->unreachable, op);
+    }
+}
+
 static bool
 scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
                   void *block, size_t block_size, void *args)
@@ -650,23 +775,12 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     }
 
     struct collection_state *state = (struct collection_state *)args;
+    if (state->type_stats) {
+        type_stats_count_scanned(&state->type_counts, op,
+                                 !gc_is_unreachable(op));
+    }
     if (gc_is_unreachable(op)) {
-        // Disable deferred refcounting for unreachable objects so that they
-        // are collected immediately after finalization.
-        disable_deferred_refcounting(op);
-
-        // Merge and add one to the refcount to prevent deallocation while we
-        // are holding on to it in a worklist.
-        merge_refcount(op, 1);
-
-        if (has_legacy_finalizer(op)) {
-            // would be unreachable, but has legacy finalizer
-            gc_clear_unreachable(op);
-            worklist_push(&state->legacy_finalizers, op);
-        }
-        else {
-            worklist_push(&state->unreachable, op);
-        }
+        scan_unreachable(state, op);
         return true;
     }
 
@@ -683,6 +797,706 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+// Parallel marking
+// ================
+//
+// With PYTHON_GC_THREADS set to more than one, the collector splits
+// update_refs, marking and scanning across a pool of helper threads. The
+// pool is started by the first parallel collection, and its threads park
+// between collections. The collecting thread takes part as worker zero.
+//
+// The helper threads have no thread state, since they run while the world
+// is stopped, and must not allocate from the mimalloc heaps, call into
+// Python, or use _PyThreadState_GET(); anything that needs to do so is
+// queued for the collecting thread. That includes traversing objects whose
+// tp_traverse we don't know, see gc_helper_can_traverse().
+//
+// The heap pages are collected up front, and each phase hands them out to
+// the threads a few at a time. update_refs is split in two phases, so that
+// every object is initialized before any thread decrements its gc_refs.
+//
+// While marking, each thread keeps the objects it still has to traverse in
+// a private worklist linked through ob_tid. An object only goes on a
+// worklist after its unreachable bit has been atomically cleared, at
+// which point its gc_refs are no longer needed. Threads that run out of
+// work steal the worklists that busy threads share.
+
+enum gc_parallel_phase {
+    PARALLEL_INIT_REFS,
+    PARALLEL_SUBTRACT_REFS,
+    PARALLEL_MARK,
+    PARALLEL_SCAN,
+    PARALLEL_NUM_PHASES,
+};
+
+struct gc_page {
+    mi_page_t *page;
+    mi_heap_area_t area;
+    size_t offset;  // offset of PyObject from start of block
+    // Set if a helper thread left objects on the page for the collecting
+    // thread to traverse in PARALLEL_SUBTRACT_REFS.
+    int deferred;
+};
+
+struct gc_parallel;
+
+struct gc_worker {
+    struct visitor_args base;
+    struct gc_parallel *par;
+    // The page being visited
+    struct gc_page *page;
+
+    // Objects to traverse while marking, and the number pushed since the
+    // worklist was last shared.
+    struct worklist work;
+    Py_ssize_t pushed;
+
+    // Marking work other threads can steal, protected by `mutex`.
+    PyMutex mutex;
+    struct worklist shared;
+
+    // Results of the scan phase, handled by the collecting thread.
+    struct worklist unreachable;
+    struct worklist needs_merge;
+    Py_ssize_t long_lived_total;
+    struct _Py_hashtable_t *type_counts;
+};
+
+struct gc_parallel {
+    struct gc_page *pages;
+    Py_ssize_t num_pages;
+    Py_ssize_t next_page[PARALLEL_NUM_PHASES];
+
+    struct gc_worker *workers;
+    int num_workers;
+
+    // Record per-type statistics (DEBUG_TYPE_STATS)
+    int type_stats;
+
+    // Number of threads that may still produce marking work.
+    int active;
+
+    // Objects the helper threads reached while marking but left for the
+    // collecting thread to traverse, protected by `deferred_mutex`.
+    PyMutex deferred_mutex;
+    struct worklist deferred;
+
+    int remaining[PARALLEL_NUM_PHASES];
+    PyEvent start[PARALLEL_NUM_PHASES];
+    PyEvent done[PARALLEL_NUM_PHASES];
+};
+
+struct collect_pages_args {
+    struct visitor_args base;
+    struct gc_page *pages;
+    Py_ssize_t num_pages;
+    Py_ssize_t capacity;
+};
+
+// Called once per heap area (without visiting the blocks).
+static bool
+collect_page(const mi_heap_t *heap, const mi_heap_area_t *area,
+             void *block, size_t block_size, void *args)
+{
+    assert(block == NULL);
+    struct collect_pages_args *a = (struct collect_pages_args *)args;
+    if (area->used == 0) {
+        return true;
+    }
+    if (a->num_pages == a->capacity) {
+        Py_ssize_t capacity = a->capacity ? a->capacity * 2 : 256;
+        struct gc_page *pages = PyMem_RawRealloc(a->pages,
+                                                 capacity * sizeof(*pages));
+        if (pages == NULL) {
+            return false;
+        }
+        a->pages = pages;
+        a->capacity = capacity;
+    }
+    struct gc_page *p = &a->pages[a->num_pages++];
+    p->page = _mi_ptr_page(area->blocks);
+    p->area = *area;
+    p->offset = a->base.offset;
+    p->deferred = 0;
+    return true;
+}
+
+// Visit the blocks of the pages that this thread claims.
+static void
+gc_parallel_visit_pages(struct gc_worker *w, enum gc_parallel_phase phase,
+                        mi_block_visit_fun *visitor)
+{
+    struct gc_parallel *par = w->par;
+    for (;;) {
+        Py_ssize_t start = _Py_atomic_add_ssize(&par->next_page[phase],
+                                                PARALLEL_PAGES_PER_CLAIM);
+        if (start >= par->num_pages) {
+            return;
+        }
+        Py_ssize_t end = Py_MIN(start + PARALLEL_PAGES_PER_CLAIM,
+                                par->num_pages);
+        for (Py_ssize_t i = start; i < end; i++) {
+            struct gc_page *p = &par->pages[i];
+            w->base.offset = p->offset;
+            w->page = p;
+            _mi_heap_area_visit_blocks(&p->area, p->page, visitor, w);
+        }
+    }
+}
+
+// Whether a helper thread, which has no thread state, may traverse op.
+// That is only known for the core's static types, and for the classes that
+// extend them without a tp_traverse of their own, whose subtype_traverse()
+// only adds the slots, dict and type. The tp_traverse of other types, and
+// the traversal of modules and capsules, which call out to extensions, may
+// need a thread state.
+static int
+gc_helper_can_traverse(PyObject *op)
+{
+    PyTypeObject *tp = _PyType_GetTraverseBase(Py_TYPE(op));
+    return ((tp->tp_flags & _Py_TPFLAGS_STATIC_BUILTIN)
+            && tp != &PyModule_Type
+            && tp != &PyCapsule_Type);
+}
+
+static inline int
+gc_is_helper(struct gc_worker *w)
+{
+    return w != &w->par->workers[0];
+}
+
+// First half of update_refs: initialize gc_refs to the refcount.
+static bool
+init_refs_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
+                  void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+
+    // Only this thread writes to op's ob_gc_bits in this phase, although
+    // others may read them when untracking tuples.
+    if (_Py_IsImmortal(op)) {
+        op->ob_tid = 0;
+        _PyObject_GC_UNTRACK(op);
+        gc_clear_unreachable(op);
+        return true;
+    }
+
+    Py_ssize_t refcount = Py_REFCNT(op);
+    if (_PyObject_HasDeferredRefcount(op)) {
+        refcount -= _Py_REF_DEFERRED;
+    }
+    _PyObject_ASSERT(op, refcount >= 0);
+
+    if (refcount > 0 && !_PyObject_HasDeferredRefcount(op)) {
+        if (PyTuple_CheckExact(op)) {
+            _PyTuple_MaybeUntrack(op);
+            if (!_PyObject_GC_IS_TRACKED(op)) {
+                return true;
+            }
+        }
+    }
+
+    gc_set_unreachable(op);
+    op->ob_tid = (uintptr_t)refcount;
+    return true;
+}
+
+static int
+visit_decref_atomic(PyObject *op, void *arg)
+{
+    if (_PyObject_GC_IS_TRACKED(op)
+        && !_Py_IsImmortal(op)
+        && !gc_is_frozen(op)
+        && gc_is_unreachable(op))
+    {
+        _Py_atomic_add_uintptr(&op->ob_tid, (uintptr_t)-1);
+    }
+    return 0;
+}
+
+// Second half of update_refs: subtract internal references.
+static bool
+subtract_refs_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
+                      void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+    struct gc_worker *w = (struct gc_worker *)args;
+    if (gc_is_helper(w) && !gc_helper_can_traverse(op)) {
+        w->page->deferred = 1;
+        return true;
+    }
+    Py_TYPE(op)->tp_traverse(op, visit_decref_atomic, NULL);
+    return true;
+}
+
+// Subtract the internal references of the objects that the helper threads
+// left for the collecting thread.
+static bool
+subtract_deferred_refs_visitor(const mi_heap_t *heap,
+                               const mi_heap_area_t *area,
+                               void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL || gc_helper_can_traverse(op)) {
+        return true;
+    }
+    Py_TYPE(op)->tp_traverse(op, visit_decref_atomic, NULL);
+    return true;
+}
+
+// Atomically clear the unreachable bit. Returns 1 if this thread cleared it.
+static int
+gc_try_clear_unreachable(PyObject *op)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if ((bits & _PyGC_BITS_UNREACHABLE) == 0) {
+        return 0;
+    }
+    bits = _Py_atomic_and_uint8(&op->ob_gc_bits,
+                                (uint8_t)~_PyGC_BITS_UNREACHABLE);
+    return (bits & _PyGC_BITS_UNREACHABLE) != 0;
+}
+
+// Share all but the first object of the worklist if the shared worklist
+// is empty and some thread is waiting for work.
+static void
+gc_share_work(struct gc_worker *w)
+{
+    struct gc_parallel *par = w->par;
+    w->pushed = 0;
+    if (_Py_atomic_load_int_relaxed(&par->active) == par->num_workers ||
+        _Py_atomic_load_uintptr_relaxed(&w->shared.head) != 0)
+    {
+        return;
+    }
+    PyObject *first = (PyObject *)w->work.head;
+    uintptr_t rest = _Py_atomic_load_uintptr_relaxed(&first->ob_tid);
+    if (rest == 0) {
+        return;
+    }
+    PyMutex_LockFlags(&w->mutex, _Py_LOCK_DONT_DETACH);
+    if (w->shared.head == 0) {
+        _Py_atomic_store_uintptr_relaxed(&first->ob_tid, 0);
+        _Py_atomic_store_uintptr_relaxed(&w->shared.head, rest);
+    }
+    PyMutex_Unlock(&w->mutex);
+}
+
+static void
+gc_mark_push(struct gc_worker *w, PyObject *op)
+{
+    _Py_atomic_store_uintptr_relaxed(&op->ob_tid, 0);
+    worklist_push(&w->work, op);
+    if (++w->pushed >= PARALLEL_SHARE_THRESHOLD) {
+        gc_share_work(w);
+    }
+}
+
+static int
+visit_clear_unreachable_parallel(PyObject *op, void *arg)
+{
+    if (gc_try_clear_unreachable(op)) {
+        _PyObject_ASSERT(op, _PyObject_GC_IS_TRACKED(op));
+        gc_mark_push((struct gc_worker *)arg, op);
+    }
+    return 0;
+}
+
+static void
+gc_mark_drain(struct gc_worker *w)
+{
+    struct gc_parallel *par = w->par;
+    int helper = gc_is_helper(w);
+    PyObject *op;
+    while ((op = worklist_pop(&w->work)) != NULL) {
+        if (helper && !gc_helper_can_traverse(op)) {
+            PyMutex_LockFlags(&par->deferred_mutex, _Py_LOCK_DONT_DETACH);
+            _Py_atomic_store_uintptr_relaxed(&op->ob_tid, par->deferred.head);
+            _Py_atomic_store_uintptr_relaxed(&par->deferred.head,
+                                             (uintptr_t)op);
+            PyMutex_Unlock(&par->deferred_mutex);
+            continue;
+        }
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        (void)traverse(op, visit_clear_unreachable_parallel, w);
+    }
+}
+
+// Take the objects deferred by the helper threads. Returns 1 on success.
+static int
+gc_take_deferred(struct gc_worker *w)
+{
+    struct gc_parallel *par = w->par;
+    assert(!gc_is_helper(w) && w->work.head == 0);
+    if (_Py_atomic_load_uintptr_relaxed(&par->deferred.head) == 0) {
+        return 0;
+    }
+    PyMutex_LockFlags(&par->deferred_mutex, _Py_LOCK_DONT_DETACH);
+    w->work.head = par->deferred.head;
+    _Py_atomic_store_uintptr_relaxed(&par->deferred.head, 0);
+    PyMutex_Unlock(&par->deferred_mutex);
+    w->pushed = 0;
+    return w->work.head != 0;
+}
+
+static bool
+mark_heap_visitor_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                           void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+
+    // Another thread may clear the unreachable bit and then reuse ob_tid
+    // for its worklist, but the atomic clear decides who traverses op.
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if ((bits & _PyGC_BITS_UNREACHABLE) &&
+        _Py_atomic_load_uintptr_relaxed(&op->ob_tid) != 0 &&
+        gc_try_clear_unreachable(op))
+    {
+        struct gc_worker *w = (struct gc_worker *)args;
+        gc_mark_push(w, op);
+        gc_mark_drain(w);
+    }
+    return true;
+}
+
+// Take the shared worklist of another thread. Returns 1 on success.
+static int
+gc_steal_work(struct gc_worker *w)
+{
+    struct gc_parallel *par = w->par;
+    assert(w->work.head == 0);
+    int n = par->num_workers;
+    int self = (int)(w - par->workers);
+    for (int i = 0; i < n; i++) {
+        struct gc_worker *victim = &par->workers[(self + i) % n];
+        if (_Py_atomic_load_uintptr_relaxed(&victim->shared.head) == 0) {
+            continue;
+        }
+        PyMutex_LockFlags(&victim->mutex, _Py_LOCK_DONT_DETACH);
+        w->work.head = victim->shared.head;
+        _Py_atomic_store_uintptr_relaxed(&victim->shared.head, 0);
+        PyMutex_Unlock(&victim->mutex);
+        if (w->work.head != 0) {
+            w->pushed = 0;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void
+gc_parallel_mark(struct gc_worker *w)
+{
+    struct gc_parallel *par = w->par;
+    gc_parallel_visit_pages(w, PARALLEL_MARK, mark_heap_visitor_parallel);
+
+    // A thread only stops being active once it has no work of its own and
+    // has found every shared worklist empty. Marking is finished when no
+    // thread is active. The collecting thread also looks for deferred
+    // objects, after checking `active`: a helper defers objects before it
+    // becomes inactive, so none can be missed. If it finds some after the
+    // helpers are done, it finishes marking on its own.
+    int helper = gc_is_helper(w);
+    for (;;) {
+        while (gc_steal_work(w) || (!helper && gc_take_deferred(w))) {
+            gc_mark_drain(w);
+        }
+        _Py_atomic_add_int(&par->active, -1);
+        for (;;) {
+            int done = _Py_atomic_load_int(&par->active) == 0;
+            if (!helper &&
+                _Py_atomic_load_uintptr_relaxed(&par->deferred.head) != 0)
+            {
+                _Py_atomic_add_int(&par->active, 1);
+                break;
+            }
+            if (done) {
+                return;
+            }
+            int found = 0;
+            for (int i = 0; i < par->num_workers; i++) {
+                if (_Py_atomic_load_uintptr_relaxed(&par->workers[i].shared.head)) {
+                    found = 1;
+                    break;
+                }
+            }
+            if (found) {
+                _Py_atomic_add_int(&par->active, 1);
+                break;
+            }
+            _Py_yield();
+        }
+    }
+}
+
+static bool
+scan_heap_visitor_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                           void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+
+    struct gc_worker *w = (struct gc_worker *)args;
+    if (w->par->type_stats) {
+        type_stats_count_scanned(&w->type_counts, op, !gc_is_unreachable(op));
+    }
+    if (gc_is_unreachable(op)) {
+        // The gc_refs of objects left unreachable are zero.
+        assert(op->ob_tid == 0);
+        worklist_push(&w->unreachable, op);
+        return true;
+    }
+
+    // Like gc_restore_tid(), except that merging the refcount is left to
+    // the collecting thread.
+    if (_Py_REF_IS_MERGED(op->ob_ref_shared)) {
+        op->ob_tid = 0;
+    }
+    else {
+        op->ob_tid = _mi_ptr_segment(op)->thread_id;
+        if (op->ob_tid == 0) {
+            worklist_push(&w->needs_merge, op);
+        }
+    }
+    w->long_lived_total++;
+    return true;
+}
+
+static void
+gc_parallel_run_phase(struct gc_worker *w, enum gc_parallel_phase phase)
+{
+    struct gc_parallel *par = w->par;
+    switch (phase) {
+        case PARALLEL_INIT_REFS:
+            gc_parallel_visit_pages(w, phase, init_refs_visitor);
+            break;
+        case PARALLEL_SUBTRACT_REFS:
+            gc_parallel_visit_pages(w, phase, subtract_refs_visitor);
+            break;
+        case PARALLEL_MARK:
+            gc_parallel_mark(w);
+            break;
+        case PARALLEL_SCAN:
+            gc_parallel_visit_pages(w, phase, scan_heap_visitor_parallel);
+            break;
+        default:
+            Py_UNREACHABLE();
+    }
+    if (_Py_atomic_add_int(&par->remaining[phase], -1) == 1) {
+        _PyEvent_Notify(&par->done[phase]);
+    }
+}
+
+static void
+gc_event_wait(PyEvent *evt)
+{
+    // Don't detach: the collecting thread has stopped the world.
+    while (!PyEvent_WaitTimed(evt, -1, /*detach=*/0)) {
+    }
+}
+
+// A helper thread of the pool.
+struct gc_pool_thread {
+    // The worker to run as in the current collection, or NULL to exit.
+    struct gc_worker *worker;
+    // Notified when `worker` is set.
+    PyEvent wake;
+    PyThread_handle_t handle;
+};
+
+struct _gc_worker_pool {
+    struct gc_pool_thread *threads;
+    int num_threads;  // number of threads started
+};
+
+static void
+gc_pool_thread(void *arg)
+{
+    struct gc_pool_thread *t = (struct gc_pool_thread *)arg;
+    for (;;) {
+        gc_event_wait(&t->wake);
+        // The event is only notified again once this thread has been
+        // through all the phases of the collection, so it can be reset.
+        t->wake = (PyEvent){0};
+        struct gc_worker *w = t->worker;
+        if (w == NULL) {
+            return;
+        }
+        for (int phase = 0; phase < PARALLEL_NUM_PHASES; phase++) {
+            gc_event_wait(&w->par->start[phase]);
+            gc_parallel_run_phase(w, phase);
+        }
+    }
+}
+
+// Start up to n threads in the pool. Returns the number of threads that
+// are running.
+static int
+gc_start_pool_threads(GCState *gcstate, int n)
+{
+    struct _gc_worker_pool *pool = gcstate->worker_pool;
+    if (pool == NULL) {
+        pool = PyMem_RawCalloc(1, sizeof(*pool));
+        if (pool == NULL) {
+            return 0;
+        }
+        pool->threads = PyMem_RawCalloc(gcstate->parallel_threads - 1,
+                                        sizeof(struct gc_pool_thread));
+        if (pool->threads == NULL) {
+            PyMem_RawFree(pool);
+            return 0;
+        }
+        gcstate->worker_pool = pool;
+    }
+    assert(n < gcstate->parallel_threads);
+    while (pool->num_threads < n) {
+        struct gc_pool_thread *t = &pool->threads[pool->num_threads];
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(gc_pool_thread, t,
+                                           &ident, &t->handle) != 0) {
+            break;
+        }
+        pool->num_threads++;
+    }
+    return Py_MIN(n, pool->num_threads);
+}
+
+static void
+gc_fini_worker_pool(GCState *gcstate)
+{
+    struct _gc_worker_pool *pool = gcstate->worker_pool;
+    if (pool == NULL) {
+        return;
+    }
+    gcstate->worker_pool = NULL;
+    for (int i = 0; i < pool->num_threads; i++) {
+        struct gc_pool_thread *t = &pool->threads[i];
+        t->worker = NULL;
+        _PyEvent_Notify(&t->wake);
+        PyThread_join_thread(t->handle);
+    }
+    PyMem_RawFree(pool->threads);
+    PyMem_RawFree(pool);
+}
+
+void
+_PyGC_AfterForkWorkerPool(PyInterpreterState *interp)
+{
+    struct _gc_worker_pool *pool = interp->gc.worker_pool;
+    if (pool == NULL) {
+        return;
+    }
+    // The threads didn't survive the fork. New ones are started by the
+    // next parallel collection.
+    interp->gc.worker_pool = NULL;
+    PyMem_RawFree(pool->threads);
+    PyMem_RawFree(pool);
+}
+
+// Run a phase on all threads and wait for it to finish.
+static void
+gc_parallel_phase(struct gc_parallel *par, enum gc_parallel_phase phase)
+{
+    _PyEvent_Notify(&par->start[phase]);
+    gc_parallel_run_phase(&par->workers[0], phase);
+    gc_event_wait(&par->done[phase]);
+    if (phase == PARALLEL_SUBTRACT_REFS) {
+        // Traverse the objects the helpers left on their pages
+        struct gc_worker *w = &par->workers[0];
+        for (Py_ssize_t i = 0; i < par->num_pages; i++) {
+            struct gc_page *p = &par->pages[i];
+            if (p->deferred) {
+                w->base.offset = p->offset;
+                _mi_heap_area_visit_blocks(&p->area, p->page,
+                                           subtract_deferred_refs_visitor, w);
+            }
+        }
+    }
+}
+
+// Collect the heap pages and wake the pool's threads, starting them if
+// needed. Returns 0 if the heap is too small for parallel marking or on
+// error, in which case the collection falls back to visiting the heaps on
+// this thread.
+static int
+gc_parallel_start(struct gc_parallel *par, PyInterpreterState *interp,
+                  struct collection_state *state)
+{
+    memset(par, 0, sizeof(*par));
+    int num_threads = state->gcstate->parallel_threads;
+    if (num_threads <= 1 || state->reason == _Py_GC_REASON_SHUTDOWN) {
+        return 0;
+    }
+    struct collect_pages_args args = {0};
+    HEAD_LOCK(&_PyRuntime);
+    int err = gc_visit_heaps_lock_held(interp, false, collect_page, &args.base);
+    HEAD_UNLOCK(&_PyRuntime);
+    num_threads = (int)Py_MIN(num_threads,
+                              args.num_pages / PARALLEL_MIN_PAGES_PER_THREAD);
+    if (err < 0 || num_threads <= 1) {
+        PyMem_RawFree(args.pages);
+        return 0;
+    }
+    par->workers = PyMem_RawCalloc(num_threads, sizeof(struct gc_worker));
+    if (par->workers == NULL) {
+        PyMem_RawFree(args.pages);
+        return 0;
+    }
+    par->pages = args.pages;
+    par->num_pages = args.num_pages;
+    par->type_stats = state->type_stats;
+
+    par->workers[0].par = par;
+    par->num_workers = 1;
+    // Carry on with the threads we have if some can't be started.
+    int helpers = gc_start_pool_threads(state->gcstate, num_threads - 1);
+    struct _gc_worker_pool *pool = state->gcstate->worker_pool;
+    for (int i = 0; i < helpers; i++) {
+        struct gc_worker *w = &par->workers[par->num_workers++];
+        w->par = par;
+        pool->threads[i].worker = w;
+        _PyEvent_Notify(&pool->threads[i].wake);
+    }
+    par->active = par->num_workers;
+    for (int phase = 0; phase < PARALLEL_NUM_PHASES; phase++) {
+        par->remaining[phase] = par->num_workers;
+    }
+    return 1;
+}
+
+// Hand the results of the workers to the collection.
+static void
+gc_parallel_finish(struct gc_parallel *par, struct collection_state *state)
+{
+    assert(par->deferred.head == 0);
+    for (int i = 0; i < par->num_workers; i++) {
+        struct gc_worker *w = &par->workers[i];
+        assert(w->work.head == 0 && w->shared.head == 0);
+        PyObject *op;
+        while ((op = worklist_pop(&w->needs_merge)) != NULL) {
+            merge_refcount(op, 0);
+        }
+        while ((op = worklist_pop(&w->unreachable)) != NULL) {
+            scan_unreachable(state, op);
+        }
+        state->long_lived_total += w->long_lived_total;
+        type_stats_merge(state->gcstate, w->type_counts);
+    }
+    PyMem_RawFree(par->workers);
+    PyMem_RawFree(par->pages);
+}
+
 static int
 move_legacy_finalizer_reachable(struct collection_state *state);
 
@@ -697,10 +1511,19 @@ deduce_unreachable_heap(PyInterpreterState *interp,
     gc_visit_heaps(interp, &validate_refcounts, &state->base);
 #endif
 
+    struct gc_parallel par;
+    int parallel = gc_parallel_start(&par, interp, state);
+
     // Identify objects that are directly reachable from outside the GC heap
     // by computing the difference between the refcount and the number of
     // incoming references.
-    gc_visit_heaps(interp, &update_refs, &state->base);
+    if (parallel) {
+        gc_parallel_phase(&par, PARALLEL_INIT_REFS);
+        gc_parallel_phase(&par, PARALLEL_SUBTRACT_REFS);
+    }
+    else {
+        gc_visit_heaps(interp, &update_refs, &state->base);
+    }
 
 #ifdef GC_DEBUG
     // Check that all objects are marked as unreachable and that the computed
@@ -711,17 +1534,28 @@ deduce_unreachable_heap(PyInterpreterState *interp,
     // Visit the thread stacks to account for any deferred references.
     gc_visit_thread_stacks(interp);
 
-    // Transitively mark reachable objects by clearing the
-    // _PyGC_BITS_UNREACHABLE flag.
-    if (gc_visit_heaps(interp, &mark_heap_visitor, &state->base) < 0) {
-        // On out-of-memory, restore the refcounts and bail out.
-        gc_visit_heaps(interp, &restore_refs, &state->base);
-        return -1;
+    if (parallel) {
+        // Marking and scanning can't fail when run in parallel, because
+        // the worklists don't allocate.
+        gc_parallel_phase(&par, PARALLEL_MARK);
+        gc_parallel_phase(&par, PARALLEL_SCAN);
+        gc_parallel_finish(&par, state);
     }
+    else {
+        // Transitively mark reachable objects by clearing the
+        // _PyGC_BITS_UNREACHABLE flag.
+        if (gc_visit_heaps(interp, &mark_heap_visitor, &state->base) < 0) {
+            // On out-of-memory, restore the refcounts and bail out.
+            gc_visit_heaps(interp, &restore_refs, &state->base);
+            return -1;
+        }
 
-    // Identify remaining unreachable objects and push them onto a stack.
-    // Restores ob_tid for reachable objects.
-    gc_visit_heaps(interp, &scan_heap_visitor, &state->base);
+        // Identify remaining unreachable objects and push them onto a stack.
+        // Restores ob_tid for reachable objects.
+        gc_visit_heaps(interp, &scan_heap_visitor, &state->base);
+        type_stats_merge(state->gcstate, state->type_counts);
+        state->type_counts = NULL;
+    }
 
     if (state->legacy_finalizers.head) {
         // There may be objects reachable from legacy finalizers that are in
@@ -870,6 +1704,21 @@ _PyGC_Init(PyInterpreterState *interp)
         return _PyStatus_NO_MEMORY();
     }
 
+    gcstate->parallel_threads = 1;
+    char *env = Py_GETENV("PYTHON_GC_THREADS");
+    if (env && *env != '\0') {
+        char *endptr;
+        errno = 0;
+        unsigned long threads = strtoul(env, &endptr, 10);
+        if (*endptr != '\0' || errno == ERANGE
+            || threads < 1 || threads > 1024)
+        {
+            return _PyStatus_ERR("PYTHON_GC_THREADS must be "
+                                 "an integer in range [1; 1024]");
+        }
+        gcstate->parallel_threads = (int)threads;
+    }
+
     return _PyStatus_OK();
 }
 
@@ -929,6 +1778,15 @@ delete_garbage(struct collection_state *state)
         }
 
         state->collected++;
+        if (state->type_stats) {
+            PyMutex_Lock(&gcstate->type_stats_mutex);
+            struct gc_type_stats *st = type_stats_get(&gcstate->type_stats,
+                                                      Py_TYPE(op));
+            if (st != NULL) {
+                st->collected++;
+            }
+            PyMutex_Unlock(&gcstate->type_stats_mutex);
+        }
 
         if (gcstate->debug & _PyGC_DEBUG_SAVEALL) {
             assert(gcstate->garbage != NULL);
@@ -998,7 +1856,8 @@ _PyGC_VisitStackRef(_PyStackRef *ref, visitproc visit, void *arg)
     // computing the incoming references, but otherwise treat them like
     // regular references.
     if (!PyStackRef_IsDeferred(*ref) ||
-        (visit != visit_decref && visit != visit_decref_unreachable))
+        (visit != visit_decref && visit != visit_decref_atomic &&
+         visit != visit_decref_unreachable))
     {
         Py_VISIT(PyStackRef_AsPyObjectBorrow(*ref));
     }
@@ -1358,6 +2217,7 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         .interp = interp,
         .gcstate = gcstate,
         .reason = reason,
+        .type_stats = (gcstate->debug & _PyGC_DEBUG_TYPE_STATS) != 0,
     };
 
     gc_collect_internal(interp, &state, generation);
@@ -1548,6 +2408,87 @@ _PyGC_GetObjects(PyInterpreterState *interp, int generation)
     return list;
 }
 
+struct type_stats_entry {
+    PyTypeObject *type;
+    struct gc_type_stats stats;
+};
+
+static int
+copy_type_stats(_Py_hashtable_t *ht, const void *key, const void *value,
+                void *user_data)
+{
+    struct type_stats_entry **next = (struct type_stats_entry **)user_data;
+    // Skip a type whose last reference is gone: another thread is about to
+    // remove it in type_dealloc().
+    if (!_Py_TryIncref((PyObject *)key)) {
+        return 0;
+    }
+    (*next)->type = (PyTypeObject *)key;
+    (*next)->stats = *(const struct gc_type_stats *)value;
+    (*next)++;
+    return 0;
+}
+
+PyObject *
+_PyGC_GetTypeStats(PyInterpreterState *interp, int reset)
+{
+    GCState *gcstate = &interp->gc;
+
+    // Copy the entries with the lock held, then build the result without it.
+    PyMutex_Lock(&gcstate->type_stats_mutex);
+    _Py_hashtable_t *table = gcstate->type_stats;
+    size_t n = table != NULL ? _Py_hashtable_len(table) : 0;
+    struct type_stats_entry *entries = NULL;
+    if (n > 0) {
+        entries = PyMem_RawMalloc(n * sizeof(struct type_stats_entry));
+        if (entries == NULL) {
+            PyMutex_Unlock(&gcstate->type_stats_mutex);
+            return PyErr_NoMemory();
+        }
+        struct type_stats_entry *next = entries;
+        _Py_hashtable_foreach(table, copy_type_stats, &next);
+        n = next - entries;
+    }
+    if (reset) {
+        gcstate->type_stats = NULL;
+    }
+    PyMutex_Unlock(&gcstate->type_stats_mutex);
+    if (reset && table != NULL) {
+        _Py_hashtable_destroy(table);
+    }
+
+    PyObject *result = PyDict_New();
+    for (size_t i = 0; i < n && result != NULL; i++) {
+        struct gc_type_stats *st = &entries[i].stats;
+        PyObject *value = Py_BuildValue("{snsnsn}",
+                                        "traversed", st->traversed,
+                                        "survived", st->survived,
+                                        "collected", st->collected);
+        if (value == NULL ||
+            PyDict_SetItem(result, (PyObject *)entries[i].type, value) < 0)
+        {
+            Py_CLEAR(result);
+        }
+        Py_XDECREF(value);
+    }
+    for (size_t i = 0; i < n; i++) {
+        Py_DECREF(entries[i].type);
+    }
+    PyMem_RawFree(entries);
+    return result;
+}
+
+void
+_PyGC_RemoveTypeStats(PyInterpreterState *interp, PyTypeObject *type)
+{
+    GCState *gcstate = &interp->gc;
+    PyMutex_Lock(&gcstate->type_stats_mutex);
+    if (gcstate->type_stats != NULL) {
+        free(_Py_hashtable_steal(gcstate->type_stats, type));
+    }
+    PyMutex_Unlock(&gcstate->type_stats_mutex);
+}
+
 static bool
 visit_freeze(const mi_heap_t *heap, const mi_heap_area_t *area,
              void *block, size_t block_size, void *args)
@@ -1615,6 +2556,117 @@ _PyGC_GetFreezeCount(PyInterpreterState *interp)
     return args.count;
 }
 
+// Objects that can't be made immortal, or are already
+static int
+skip_immortalize(PyObject *op)
+{
+    // Only interned strings may be immortal, and they are made immortal
+    // when they are interned.
+    return _Py_IsImmortal(op) || PyUnicode_Check(op);
+}
+
+static void
+immortalize_object(PyObject *op)
+{
+#ifdef Py_REF_DEBUG
+    // Decrements of immortal objects aren't registered
+    Py_ssize_t refcount = Py_REFCNT(op);
+    if (_PyObject_HasDeferredRefcount(op)) {
+        refcount -= _Py_REF_DEFERRED;
+    }
+    _Py_AddRefTotal(_PyThreadState_GET(), -refcount);
+#endif
+    _Py_SetImmortal(op);
+}
+
+struct immortalize_args {
+    struct visitor_args base;
+    int depth;
+    Py_ssize_t count;
+};
+
+// Untracked containers aren't visited by gc_visit_heaps(), so they are made
+// immortal when they are found from a tracked object. The depth is limited
+// to avoid a C stack overflow; the rest simply stays mortal.
+#define IMMORTALIZE_MAX_DEPTH 100
+
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    struct immortalize_args *args = (struct immortalize_args *)arg;
+    if (skip_immortalize(op)) {
+        return 0;
+    }
+    if (PyObject_IS_GC(op)) {
+        if (_PyObject_GC_IS_TRACKED(op)
+            || args->depth >= IMMORTALIZE_MAX_DEPTH)
+        {
+            return 0;
+        }
+        immortalize_object(op);
+        args->count++;
+        args->depth++;
+        (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, args);
+        args->depth--;
+        return 0;
+    }
+    immortalize_object(op);
+    args->count++;
+    return 0;
+}
+
+static bool
+visit_heap_immortalize(const mi_heap_t *heap, const mi_heap_area_t *area,
+                       void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    // Objects with a zero refcount are garbage left for the next collection
+    if (op == NULL || skip_immortalize(op) || Py_REFCNT(op) == 0) {
+        return true;
+    }
+    struct immortalize_args *arg = (struct immortalize_args *)args;
+    immortalize_object(op);
+    arg->count++;
+    (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, arg);
+    return true;
+}
+
+Py_ssize_t
+_PyGC_Immortalize(PyThreadState *tstate)
+{
+    PyInterpreterState *interp = tstate->interp;
+    GCState *gcstate = &interp->gc;
+
+    int expected = 0;
+    if (!_Py_atomic_compare_exchange_int(&gcstate->collecting, &expected, 1)) {
+        // Don't change the refcounts that a collection is using.
+        return 0;
+    }
+
+    struct collection_state state = {
+        .interp = interp,
+        .gcstate = gcstate,
+        .reason = _Py_GC_REASON_MANUAL,
+    };
+    struct immortalize_args args = { .count = 0 };
+    _PyEval_StopTheWorld(interp);
+    // The refcounts must be merged before they are overwritten
+    _Py_FOR_EACH_TSTATE_BEGIN(interp, p) {
+        _PyThreadStateImpl *ts = (_PyThreadStateImpl *)p;
+        _PyObject_MergePerThreadRefcounts(ts);
+        merge_queued_objects(ts, &state);
+    }
+    _Py_FOR_EACH_TSTATE_END(interp);
+    gc_visit_heaps(interp, &visit_heap_immortalize, &args.base);
+    _PyEval_StartTheWorld(interp);
+
+    // Deallocate any object from the refcount merge step
+    cleanup_worklist(&state.objs_to_decref);
+
+    _Py_atomic_store_int(&gcstate->collecting, 0);
+    return args.count;
+}
+
 /* C API for controlling the state of the garbage collector */
 int
 PyGC_Enable(void)
@@ -1724,8 +2776,14 @@ void
 _PyGC_Fini(PyInterpreterState *interp)
 {
     GCState *gcstate = &interp->gc;
+    gc_fini_worker_pool(gcstate);
     Py_CLEAR(gcstate->garbage);
     Py_CLEAR(gcstate->callbacks);
+    if (gcstate->type_stats != NULL) {
+        _Py_hashtable_t *table = gcstate->type_stats;
+        gcstate->type_stats = NULL;
+        _Py_hashtable_destroy(table);
+    }
 
     /* We expect that none of this interpreters objects are shared
        with other interpreters.
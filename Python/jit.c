@@ -36,6 +36,10 @@ get_page_size(void)
 #endif
 }
 
+// Set while compiling with _PyJIT_CompileDetached, so that errors are
+// recorded rather than raised:
+static _Py_thread_local _PyJITCode *detached_code = NULL;
+
 static void
 jit_error(const char *message)
 {
@@ -44,6 +48,11 @@ jit_error(const char *message)
 #else
     int hint = errno;
 #endif
+    if (detached_code != NULL) {
+        detached_code->error = message;
+        detached_code->error_hint = hint;
+        return;
+    }
     PyErr_Format(PyExc_RuntimeWarning, "JIT %s (%d)", message, hint);
 }
 
@@ -120,6 +129,164 @@ mark_executable(unsigned char *memory, size_t size)
     return 0;
 }
 
+// Executable memory arena: ///////////////////////////////////////////////////
+
+// Executors are carved out of large chunks by a bump allocator, so the code
+// for many small executors shares a few mappings instead of each getting a
+// mapping of its own. Every executor still gets whole pages, since those are
+// the unit of memory protection: pages holding code that may be running are
+// never made writable again. Memory within a chunk is not reused. Instead,
+// chunks are unmapped in batches once all of their executors have been freed
+// (see _PyJIT_ReleaseUnusedMemory), which also keeps freed code mapped until
+// the next cleanup.
+//
+// The chunks are not backed by huge pages: flipping the protection of each
+// executor's pages would split them anyway, and keeping a huge page writable
+// and executable at once would give up W^X.
+
+#define JIT_CHUNK_SIZE (2 * 1024 * 1024)
+
+typedef struct jit_chunk {
+    struct jit_chunk *next;
+    unsigned char *memory;
+    size_t used;  // Bytes handed out so far
+    size_t live;  // Bytes handed out and not yet freed
+} jit_chunk;
+
+static struct {
+    PyMutex mutex;
+    jit_chunk *chunks;  // Newest first. Only the newest is allocated from.
+} arena;
+
+// Must be called with the arena mutex held:
+static jit_chunk *
+find_chunk(unsigned char *memory)
+{
+    for (jit_chunk *chunk = arena.chunks; chunk != NULL; chunk = chunk->next) {
+        if (chunk->memory <= memory && memory < chunk->memory + chunk->used) {
+            return chunk;
+        }
+    }
+    return NULL;
+}
+
+// Safe to call without an attached thread state.
+static unsigned char *
+arena_alloc(size_t size)
+{
+    if (size > JIT_CHUNK_SIZE / 4) {
+        // Too big to be worth sharing a chunk:
+        return jit_alloc(size);
+    }
+    unsigned char *memory = NULL;
+    PyMutex_Lock(&arena.mutex);
+    jit_chunk *chunk = arena.chunks;
+    if (chunk == NULL || JIT_CHUNK_SIZE - chunk->used < size) {
+        chunk = PyMem_RawMalloc(sizeof(jit_chunk));
+        if (chunk == NULL) {
+            jit_error("unable to allocate memory");
+            goto done;
+        }
+        chunk->memory = jit_alloc(JIT_CHUNK_SIZE);
+        if (chunk->memory == NULL) {
+            PyMem_RawFree(chunk);
+            goto done;
+        }
+        chunk->used = chunk->live = 0;
+        chunk->next = arena.chunks;
+        arena.chunks = chunk;
+    }
+    memory = chunk->memory + chunk->used;
+    chunk->used += size;
+    chunk->live += size;
+done:
+    PyMutex_Unlock(&arena.mutex);
+    return memory;
+}
+
+static int
+arena_free(unsigned char *memory, size_t size)
+{
+    PyMutex_Lock(&arena.mutex);
+    jit_chunk *chunk = find_chunk(memory);
+    if (chunk != NULL) {
+        assert(chunk->live >= size);
+        chunk->live -= size;
+    }
+    PyMutex_Unlock(&arena.mutex);
+    if (chunk == NULL) {
+        return jit_free(memory, size);
+    }
+    return 0;
+}
+
+void
+_PyJIT_ReleaseUnusedMemory(void)
+{
+    jit_chunk *dead = NULL;
+    PyMutex_Lock(&arena.mutex);
+    // The newest chunk is still being allocated from, so it always stays:
+    jit_chunk **ptr = arena.chunks ? &arena.chunks->next : &arena.chunks;
+    while (*ptr != NULL) {
+        jit_chunk *chunk = *ptr;
+        if (chunk->live == 0) {
+            *ptr = chunk->next;
+            chunk->next = dead;
+            dead = chunk;
+        }
+        else {
+            ptr = &chunk->next;
+        }
+    }
+    PyMutex_Unlock(&arena.mutex);
+    while (dead != NULL) {
+        jit_chunk *next = dead->next;
+        if (jit_free(dead->memory, JIT_CHUNK_SIZE)) {
+            PyErr_WriteUnraisable(NULL);
+        }
+        PyMem_RawFree(dead);
+        dead = next;
+    }
+}
+
+void
+_PyJIT_Fini(void)
+{
+    PyMutex_Lock(&arena.mutex);
+    jit_chunk **ptr = &arena.chunks;
+    while (*ptr != NULL) {
+        jit_chunk *chunk = *ptr;
+        // Chunks still holding code are kept: an executor that outlived the
+        // runtime would otherwise unmap memory that may have been reused.
+        if (chunk->live == 0) {
+            *ptr = chunk->next;
+            (void)jit_free(chunk->memory, JIT_CHUNK_SIZE);
+            PyMem_RawFree(chunk);
+        }
+        else {
+            ptr = &chunk->next;
+        }
+    }
+    PyMutex_Unlock(&arena.mutex);
+}
+
+bool
+_PyJIT_IsStranded(_PyExecutorObject *executor)
+{
+    unsigned char *memory = executor->jit_code;
+    if (memory == NULL) {
+        return false;
+    }
+    PyMutex_Lock(&arena.mutex);
+    jit_chunk *chunk = find_chunk(memory);
+    // An old chunk that is mostly garbage stays mapped for the sake of a few
+    // executors. They are better off being recompiled into the newest one:
+    bool stranded = chunk != NULL && chunk != arena.chunks &&
+                    chunk->live < chunk->used / 4;
+    PyMutex_Unlock(&arena.mutex);
+    return stranded;
+}
+
 // JIT compiler stuff: /////////////////////////////////////////////////////////
 
 #define SYMBOL_MASK_WORDS 4
@@ -470,8 +637,9 @@ combine_symbol_mask(const symbol_mask src, symbol_mask dest)
 }
 
 // Compiles executor in-place. Don't forget to call _PyJIT_Free later!
-int
-_PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], size_t length)
+static int
+compile_trace(_PyExecutorObject *executor, const _PyUOpInstruction trace[],
+              size_t length, _PyJITCode *result)
 {
     const StencilGroup *group;
     // Loop once to find the total compiled size:
@@ -503,7 +671,7 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     assert((page_size & (page_size - 1)) == 0);
     size_t padding = page_size - ((code_size + data_size + state.trampolines.size) & (page_size - 1));
     size_t total_size = code_size + data_size + state.trampolines.size + padding;
-    unsigned char *memory = jit_alloc(total_size);
+    unsigned char *memory = arena_alloc(total_size);
     if (memory == NULL) {
         return -1;
     }
@@ -544,15 +712,66 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     pthread_jit_write_protect_np(1);
 #endif
     if (mark_executable(memory, total_size)) {
-        jit_free(memory, total_size);
+        arena_free(memory, total_size);
+        return -1;
+    }
+    result->memory = memory;
+    result->size = total_size;
+    return 0;
+}
+
+int
+_PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], size_t length)
+{
+    _PyJITCode code = {0};
+    if (compile_trace(executor, trace, length, &code)) {
+        return -1;
+    }
+    return _PyJIT_Attach(executor, &code);
+}
+
+// Safe to call without an attached thread state, as long as the executor is
+// kept alive. The result must be passed to _PyJIT_Attach or _PyJIT_Discard.
+int
+_PyJIT_CompileDetached(_PyExecutorObject *executor,
+                       const _PyUOpInstruction trace[], size_t length,
+                       _PyJITCode *code)
+{
+    assert(detached_code == NULL);
+    detached_code = code;
+    int err = compile_trace(executor, trace, length, code);
+    detached_code = NULL;
+    return err;
+}
+
+int
+_PyJIT_Attach(_PyExecutorObject *executor, _PyJITCode *code)
+{
+    if (code->memory == NULL) {
+        assert(code->error != NULL);
+        PyErr_Format(PyExc_RuntimeWarning, "JIT %s (%d)",
+                     code->error, code->error_hint);
         return -1;
     }
-    executor->jit_code = memory;
-    executor->jit_side_entry = memory + shim.code_size;
-    executor->jit_size = total_size;
+    assert(executor->jit_code == NULL);
+    executor->jit_code = code->memory;
+    executor->jit_side_entry = code->memory + shim.code_size;
+    executor->jit_size = code->size;
+    code->memory = NULL;
+    code->size = 0;
     return 0;
 }
 
+void
+_PyJIT_Discard(_PyJITCode *code)
+{
+    if (code->memory != NULL && arena_free(code->memory, code->size)) {
+        PyErr_WriteUnraisable(NULL);
+    }
+    code->memory = NULL;
+    code->size = 0;
+}
+
 void
 _PyJIT_Free(_PyExecutorObject *executor)
 {
@@ -562,7 +781,7 @@ _PyJIT_Free(_PyExecutorObject *executor)
         executor->jit_code = NULL;
         executor->jit_side_entry = NULL;
         executor->jit_size = 0;
-        if (jit_free(memory, size)) {
+        if (arena_free(memory, size)) {
             PyErr_WriteUnraisable(NULL);
         }
     }
@@ -10,7 +10,9 @@
 #include "pycore_opcode_metadata.h" // _PyOpcode_OpName[]
 #include "pycore_opcode_utils.h"  // MAX_REAL_OPCODE
 #include "pycore_optimizer.h"     // _Py_uop_analyze_and_optimize()
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_uop_ids.h"
 #include "pycore_jit.h"
 #include <stdbool.h>
@@ -130,7 +132,7 @@ _Py_GetOptimizer(void)
 }
 
 static _PyExecutorObject *
-make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies);
+make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies, bool defer_compile);
 
 static const _PyBloomFilter EMPTY_FILTER = { 0 };
 
@@ -435,6 +437,9 @@ is_for_iter_test[MAX_UOP_ID + 1] = {
     [_GUARD_NOT_EXHAUSTED_LIST] = 1,
     [_GUARD_NOT_EXHAUSTED_TUPLE] = 1,
     [_FOR_ITER_TIER_TWO] = 1,
+    [_FOR_ITER_DICT_ITEMS_UNPACKED] = 1,
+    [_FOR_ITER_ENUMERATE_UNPACKED] = 1,
+    [_FOR_ITER_ZIP_UNPACKED] = 1,
 };
 
 static const uint16_t
@@ -1003,10 +1008,16 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     int32_t current_error_target = -1;
     int32_t current_popped = -1;
     int32_t current_exit_op = -1;
+    int32_t loop_head = -1;
     /* Leaving in NOPs slows down the interpreter and messes up the stats */
     _PyUOpInstruction *copy_to = &buffer[0];
     for (int i = 0; i < length; i++) {
         _PyUOpInstruction *inst = &buffer[i];
+        if (inst->opcode == _MAKE_WARM && loop_head < 0) {
+            /* Anything between _START_EXECUTOR and _MAKE_WARM is
+             * the loop preheader, and is not re-executed by _JUMP_TO_TOP */
+            loop_head = (int32_t)(copy_to - buffer);
+        }
         if (inst->opcode != _NOP) {
             if (copy_to != inst) {
                 *copy_to = *inst;
@@ -1016,10 +1027,17 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     }
     length = (int)(copy_to - buffer);
     int next_spare = length;
+    /* The _ENTER_GUARDED_INLINED of the inlined callee we are in, if any */
+    _PyUOpInstruction *inlined = NULL;
     for (int i = 0; i < length; i++) {
         _PyUOpInstruction *inst = &buffer[i];
         int opcode = inst->opcode;
         int32_t target = (int32_t)uop_get_target(inst);
+        if (opcode == _ENTER_GUARDED_INLINED || opcode == _RETURN_GUARDED_INLINED) {
+            /* Exits in the body can't share stubs with those outside it */
+            inlined = opcode == _ENTER_GUARDED_INLINED ? inst : NULL;
+            current_jump_target = -1;
+        }
         if (_PyUop_Flags[opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) {
             uint16_t exit_op = (_PyUop_Flags[opcode] & HAS_EXIT_FLAG) ?
                 _EXIT_TRACE : _DEOPT;
@@ -1032,10 +1050,22 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
                 jump_target = next_inst + inst->oparg + 1;
             }
             if (jump_target != current_jump_target || current_exit_op != exit_op) {
-                make_exit(&buffer[next_spare], exit_op, jump_target);
                 current_exit_op = exit_op;
                 current_jump_target = jump_target;
                 current_jump = next_spare;
+                if (inlined != NULL) {
+                    /* The exit continues in the callee, which needs its
+                     * frame. The space for the extra stub was freed by
+                     * removing the _CHECK_VALIDITY_AND_SET_IP of the
+                     * callee's instruction. */
+                    _PyUOpInstruction *materialize = &buffer[next_spare];
+                    make_exit(materialize, _MATERIALIZE_INLINED_FRAME, 0);
+                    materialize->oparg = inlined->oparg;
+                    materialize->operand0 = inlined->operand0;
+                    materialize->operand1 = inlined->operand1;
+                    next_spare++;
+                }
+                make_exit(&buffer[next_spare], exit_op, jump_target);
                 next_spare++;
             }
             buffer[i].jump_target = current_jump;
@@ -1061,8 +1091,9 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         }
         if (opcode == _JUMP_TO_TOP) {
             assert(buffer[0].opcode == _START_EXECUTOR);
+            assert(loop_head > 0);
             buffer[i].format = UOP_FORMAT_JUMP;
-            buffer[i].jump_target = 1;
+            buffer[i].jump_target = loop_head;
         }
     }
     return next_spare;
@@ -1138,7 +1169,8 @@ sanity_check(_PyExecutorObject *executor)
         CHECK(
             opcode == _DEOPT ||
             opcode == _EXIT_TRACE ||
-            opcode == _ERROR_POP_N);
+            opcode == _ERROR_POP_N ||
+            opcode == _MATERIALIZE_INLINED_FRAME);
     }
 }
 
@@ -1151,7 +1183,7 @@ sanity_check(_PyExecutorObject *executor)
  * and not a NOP.
  */
 static _PyExecutorObject *
-make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies)
+make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies, bool defer_compile)
 {
     int exit_count = count_exits(buffer, length);
     _PyExecutorObject *executor = allocate_executor(exit_count, length);
@@ -1163,6 +1195,7 @@ make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFil
     for (int i = 0; i < exit_count; i++) {
         executor->exits[i].executor = NULL;
         executor->exits[i].temperature = initial_temperature_backoff_counter();
+        executor->exits[i].taken = 0;
     }
     int next_exit = exit_count-1;
     _PyUOpInstruction *dest = (_PyUOpInstruction *)&executor->trace[length];
@@ -1213,7 +1246,7 @@ make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFil
     // This is initialized to true so we can prevent the executor
     // from being immediately detected as cold and invalidated.
     executor->vm_data.warm = true;
-    if (_PyJIT_Compile(executor, executor->trace, length)) {
+    if (!defer_compile && _PyJIT_Compile(executor, executor->trace, length)) {
         Py_DECREF(executor);
         return NULL;
     }
@@ -1242,6 +1275,285 @@ int effective_trace_length(_PyUOpInstruction *buffer, int length)
 }
 #endif
 
+/* Background compilation
+ *
+ * With PYTHON_JIT_BACKGROUND=1, executors for hot loops are not compiled by
+ * the thread that found the loop. Projecting and optimizing the trace still
+ * happens with the GIL held, since both look at the objects the trace refers
+ * to, but the finished executor is then queued for a worker thread that runs
+ * the JIT without an attached thread state. The next time the loop's backoff
+ * counter triggers, the executor is inserted into the bytecode if it has been
+ * compiled and hasn't been invalidated in the meantime. Without the JIT there
+ * is nothing to do on the worker, so the queue is only set up in JIT builds
+ * (see init_interp_main()).
+ */
+
+#define MAX_JIT_JOBS 64
+
+typedef enum {
+    JIT_JOB_QUEUED,
+    JIT_JOB_COMPILING,
+    JIT_JOB_DONE,
+} _PyJITJobState;
+
+typedef struct _PyJITJob {
+    struct _PyJITJob *next;
+    _PyJITJobState state;
+    _PyExecutorObject *executor;
+    PyCodeObject *code;
+    _Py_CODEUNIT *start;
+#ifdef _Py_JIT
+    _PyJITCode jit_code;  // Written by the worker
+#endif
+} _PyJITJob;
+
+struct _PyJITQueue {
+    PyMutex mutex;
+    _PyJITJob *head;
+    int count;
+    int stop;
+    // Bumped whenever there is new work, or the worker should stop. The
+    // worker parks on it while the queue is empty.
+    uint32_t wakeups;
+    bool started;
+    PyThread_handle_t handle;
+};
+
+static void
+jit_worker(void *arg)
+{
+    struct _PyJITQueue *queue = (struct _PyJITQueue *)arg;
+    PyMutex_Lock(&queue->mutex);
+    while (!queue->stop) {
+        _PyJITJob *job = queue->head;
+        while (job != NULL && job->state != JIT_JOB_QUEUED) {
+            job = job->next;
+        }
+        if (job == NULL) {
+            uint32_t wakeups = _Py_atomic_load_uint32(&queue->wakeups);
+            PyMutex_Unlock(&queue->mutex);
+            _PyParkingLot_Park(&queue->wakeups, &wakeups, sizeof(wakeups),
+                               -1, NULL, 0);
+            PyMutex_Lock(&queue->mutex);
+            continue;
+        }
+        job->state = JIT_JOB_COMPILING;
+        PyMutex_Unlock(&queue->mutex);
+#ifdef _Py_JIT
+        _PyExecutorObject *executor = job->executor;
+        (void)_PyJIT_CompileDetached(executor, executor->trace,
+                                     executor->code_size, &job->jit_code);
+#endif
+        PyMutex_Lock(&queue->mutex);
+        job->state = JIT_JOB_DONE;
+    }
+    PyMutex_Unlock(&queue->mutex);
+}
+
+static void
+wake_worker(struct _PyJITQueue *queue)
+{
+    _Py_atomic_add_uint32(&queue->wakeups, 1);
+    _PyParkingLot_UnparkAll(&queue->wakeups);
+}
+
+static int
+start_worker(struct _PyJITQueue *queue)
+{
+    if (queue->started) {
+        return 0;
+    }
+    PyThread_ident_t ident;
+    if (PyThread_start_joinable_thread(jit_worker, queue, &ident, &queue->handle)) {
+        return -1;
+    }
+    queue->started = true;
+    return 0;
+}
+
+static void
+free_job(_PyJITJob *job)
+{
+#ifdef _Py_JIT
+    _PyJIT_Discard(&job->jit_code);
+#endif
+    Py_DECREF(job->executor);
+    Py_DECREF(job->code);
+    PyMem_Free(job);
+}
+
+/* Frees jobs that can never be installed: those whose executor has been
+ * invalidated, or whose code object is only kept alive by the job. */
+static void
+prune_jobs(struct _PyJITQueue *queue)
+{
+    _PyJITJob *dead = NULL;
+    PyMutex_Lock(&queue->mutex);
+    _PyJITJob **ptr = &queue->head;
+    while (*ptr != NULL) {
+        _PyJITJob *job = *ptr;
+        if (job->state != JIT_JOB_COMPILING &&
+            (!job->executor->vm_data.valid || Py_REFCNT(job->code) == 1))
+        {
+            *ptr = job->next;
+            job->next = dead;
+            dead = job;
+            queue->count--;
+        }
+        else {
+            ptr = &job->next;
+        }
+    }
+    PyMutex_Unlock(&queue->mutex);
+    while (dead != NULL) {
+        _PyJITJob *next = dead->next;
+        free_job(dead);
+        dead = next;
+    }
+}
+
+/* Queues executor to be compiled for the loop at start. Returns -1 if it
+ * can't be queued, in which case the caller must compile it. */
+static int
+queue_job(struct _PyJITQueue *queue, _PyExecutorObject *executor,
+          PyCodeObject *code, _Py_CODEUNIT *start)
+{
+    prune_jobs(queue);
+    if (queue->count >= MAX_JIT_JOBS || start_worker(queue) < 0) {
+        return -1;
+    }
+    _PyJITJob *job = PyMem_Calloc(1, sizeof(_PyJITJob));
+    if (job == NULL) {
+        return -1;
+    }
+    // Not inserted into the code object yet:
+    executor->vm_data.code = NULL;
+    job->state = JIT_JOB_QUEUED;
+    job->executor = (_PyExecutorObject *)Py_NewRef(executor);
+    job->code = (PyCodeObject *)Py_NewRef(code);
+    job->start = start;
+    PyMutex_Lock(&queue->mutex);
+    _PyJITJob **ptr = &queue->head;
+    while (*ptr != NULL) {
+        ptr = &(*ptr)->next;
+    }
+    *ptr = job;
+    queue->count++;
+    PyMutex_Unlock(&queue->mutex);
+    wake_worker(queue);
+    return 0;
+}
+
+/* Looks for a job for the loop at start. A finished job is removed from the
+ * queue and returned. If the job is still waiting to be compiled, *pending is
+ * set and NULL is returned. */
+static _PyJITJob *
+take_finished_job(struct _PyJITQueue *queue, PyCodeObject *code,
+                  _Py_CODEUNIT *start, bool *pending)
+{
+    _PyJITJob *result = NULL;
+    *pending = false;
+    PyMutex_Lock(&queue->mutex);
+    for (_PyJITJob **ptr = &queue->head; *ptr != NULL; ptr = &(*ptr)->next) {
+        _PyJITJob *job = *ptr;
+        if (job->code == code && job->start == start) {
+            if (job->state == JIT_JOB_DONE) {
+                *ptr = job->next;
+                queue->count--;
+                result = job;
+            }
+            else {
+                *pending = true;
+            }
+            break;
+        }
+    }
+    PyMutex_Unlock(&queue->mutex);
+    return result;
+}
+
+/* Consumes a finished job. Returns 1 and stores a new reference to its
+ * executor in *exec_ptr if the executor is still valid, 0 if it isn't,
+ * and -1 (with an exception set) if compilation failed. */
+static int
+finish_job(_PyJITJob *job, _PyExecutorObject **exec_ptr)
+{
+    _PyExecutorObject *executor = job->executor;
+    int res = 0;
+    if (executor->vm_data.valid) {
+#ifdef _Py_JIT
+        if (_PyJIT_Attach(executor, &job->jit_code)) {
+            res = -1;
+        }
+        else
+#endif
+        {
+            *exec_ptr = (_PyExecutorObject *)Py_NewRef(executor);
+            res = 1;
+        }
+    }
+    free_job(job);
+    return res;
+}
+
+int
+_PyOptimizer_InitBackgroundCompiler(PyInterpreterState *interp)
+{
+    assert(interp->jit_queue == NULL);
+    struct _PyJITQueue *queue = PyMem_RawCalloc(1, sizeof(struct _PyJITQueue));
+    if (queue == NULL) {
+        return -1;
+    }
+    interp->jit_queue = queue;
+    return 0;
+}
+
+void
+_PyOptimizer_FiniBackgroundCompiler(PyInterpreterState *interp)
+{
+    struct _PyJITQueue *queue = interp->jit_queue;
+    if (queue == NULL) {
+        return;
+    }
+    interp->jit_queue = NULL;
+    if (queue->started) {
+        PyMutex_Lock(&queue->mutex);
+        queue->stop = 1;
+        PyMutex_Unlock(&queue->mutex);
+        wake_worker(queue);
+        PyThread_join_thread(queue->handle);
+    }
+    _PyJITJob *job = queue->head;
+    while (job != NULL) {
+        _PyJITJob *next = job->next;
+        free_job(job);
+        job = next;
+    }
+    PyMem_RawFree(queue);
+}
+
+void
+_PyOptimizer_AfterForkBackgroundCompiler(PyInterpreterState *interp)
+{
+    struct _PyJITQueue *queue = interp->jit_queue;
+    if (queue == NULL) {
+        return;
+    }
+    // The worker didn't survive the fork. A new one is started on demand;
+    // anything the old one was in the middle of compiling is queued again
+    // (and any memory it had mapped for it is leaked).
+    queue->mutex = (PyMutex){0};
+    queue->started = false;
+    for (_PyJITJob *job = queue->head; job != NULL; job = job->next) {
+        if (job->state == JIT_JOB_COMPILING) {
+            job->state = JIT_JOB_QUEUED;
+#ifdef _Py_JIT
+            job->jit_code = (_PyJITCode){0};
+#endif
+        }
+    }
+}
+
 static int
 uop_optimize(
     _PyOptimizerObject *self,
@@ -1251,6 +1563,25 @@ uop_optimize(
     int curr_stackentries,
     bool progress_needed)
 {
+    // Executors that must make progress are inserted into the bytecode, so
+    // they can wait for the background compiler. Side exits can't.
+    struct _PyJITQueue *queue = NULL;
+    PyCodeObject *code = _PyFrame_GetCode(frame);
+    if (progress_needed) {
+        queue = _PyInterpreterState_GET()->jit_queue;
+    }
+    if (queue != NULL) {
+        bool pending;
+        _PyJITJob *job = take_finished_job(queue, code, instr, &pending);
+        if (job != NULL) {
+            return finish_job(job, exec_ptr);
+        }
+        if (pending) {
+            // The worker may not be running if we are in a forked child:
+            (void)start_worker(queue);
+            return 0;
+        }
+    }
     _PyBloomFilter dependencies;
     _Py_BloomFilter_Init(&dependencies);
     _PyUOpInstruction buffer[UOP_MAX_TRACE_LENGTH];
@@ -1292,11 +1623,24 @@ uop_optimize(
     OPT_HIST(effective_trace_length(buffer, length), optimized_trace_length_hist);
     length = prepare_for_execution(buffer, length);
     assert(length <= UOP_MAX_TRACE_LENGTH);
-    _PyExecutorObject *executor = make_executor_from_uops(buffer, length,  &dependencies);
+    _PyExecutorObject *executor = make_executor_from_uops(buffer, length,  &dependencies, queue != NULL);
     if (executor == NULL) {
         return -1;
     }
     assert(length <= UOP_MAX_TRACE_LENGTH);
+    if (queue != NULL) {
+        if (queue_job(queue, executor, code, instr) == 0) {
+            Py_DECREF(executor);
+            return 0;
+        }
+        // Couldn't queue it, so compile it here instead:
+#ifdef _Py_JIT
+        if (_PyJIT_Compile(executor, executor->trace, length)) {
+            Py_DECREF(executor);
+            return -1;
+        }
+#endif
+    }
     *exec_ptr = executor;
     return 1;
 }
@@ -1373,7 +1717,7 @@ counter_optimize(
         { .opcode = _INTERNAL_INCREMENT_OPT_COUNTER },
         { .opcode = _EXIT_TRACE, .target = (uint32_t)(target - _PyCode_CODE(code)), .format=UOP_FORMAT_TARGET }
     };
-    _PyExecutorObject *executor = make_executor_from_uops(buffer, 4, &EMPTY_FILTER);
+    _PyExecutorObject *executor = make_executor_from_uops(buffer, 4, &EMPTY_FILTER, false);
     if (executor == NULL) {
         return -1;
     }
@@ -1559,6 +1903,8 @@ void
 _Py_ExecutorInit(_PyExecutorObject *executor, const _PyBloomFilter *dependency_set)
 {
     executor->vm_data.valid = true;
+    executor->vm_data.entries = 0;
+    executor->vm_data.deopts = 0;
     for (int i = 0; i < _Py_BLOOM_FILTER_WORDS; i++) {
         executor->vm_data.bloom.bits[i] = dependency_set->bits[i];
     }
@@ -1683,6 +2029,12 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
 {
     /* Walk the list of executors */
     /* TO DO -- Use a tree to avoid traversing as many objects */
+#ifdef _Py_JIT
+    /* Unmap the code of executors freed since the last time around. Doing
+     * it before clearing more means that code is never unmapped by the same
+     * pass that frees it. */
+    _PyJIT_ReleaseUnusedMemory();
+#endif
     PyObject *invalidate = PyList_New(0);
     if (invalidate == NULL) {
         goto error;
@@ -1694,7 +2046,13 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
         assert(exec->vm_data.valid);
         _PyExecutorObject *next = exec->vm_data.links.next;
 
-        if (!exec->vm_data.warm && PyList_Append(invalidate, (PyObject *)exec) < 0) {
+        bool cold = !exec->vm_data.warm;
+#ifdef _Py_JIT
+        /* Executors left behind in mostly empty memory are treated as cold,
+         * so that hot ones get recompiled somewhere denser. */
+        cold = cold || _PyJIT_IsStranded(exec);
+#endif
+        if (cold && PyList_Append(invalidate, (PyObject *)exec) < 0) {
             goto error;
         }
         else {
@@ -1834,6 +2192,67 @@ _PyDumpExecutors(FILE *out)
     return 0;
 }
 
+static PyObject *
+executor_stats(_PyExecutorObject *executor)
+{
+    PyObject *exits = PyTuple_New(executor->exit_count);
+    if (exits == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < executor->exit_count; i++) {
+        PyObject *taken = PyLong_FromUnsignedLongLong(executor->exits[i].taken);
+        if (taken == NULL) {
+            Py_DECREF(exits);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(exits, i, taken);
+    }
+    PyCodeObject *code = executor->vm_data.code;
+    PyObject *stats;
+    if (code != NULL) {
+        int offset = executor->vm_data.index * (int)sizeof(_Py_CODEUNIT);
+        stats = Py_BuildValue("{sOsisisKsKsN}",
+            "code", code,
+            "offset", offset,
+            "line", PyCode_Addr2Line(code, offset),
+            "entries", (unsigned long long)executor->vm_data.entries,
+            "deopts", (unsigned long long)executor->vm_data.deopts,
+            "exits", exits);
+    }
+    else {
+        // Only reachable through a side exit of another executor
+        stats = Py_BuildValue("{sOsOsOsKsKsN}",
+            "code", Py_None,
+            "offset", Py_None,
+            "line", Py_None,
+            "entries", (unsigned long long)executor->vm_data.entries,
+            "deopts", (unsigned long long)executor->vm_data.deopts,
+            "exits", exits);
+    }
+    return stats;
+}
+
+/* Return a list of dicts with the execution counters of all live executors. */
+PyObject *
+_PyExecutor_GetStats(PyInterpreterState *interp)
+{
+    PyObject *result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+    for (_PyExecutorObject *exec = interp->executor_list_head; exec != NULL;) {
+        PyObject *stats = executor_stats(exec);
+        if (stats == NULL || PyList_Append(result, stats) < 0) {
+            Py_XDECREF(stats);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(stats);
+        exec = exec->vm_data.links.next;
+    }
+    return result;
+}
+
 #else
 
 int
@@ -1843,4 +2262,10 @@ _PyDumpExecutors(FILE *out)
     return -1;
 }
 
+PyObject *
+_PyExecutor_GetStats(PyInterpreterState *interp)
+{
+    return PyList_New(0);
+}
+
 #endif /* _Py_TIER2 */
@@ -401,6 +401,236 @@ eliminate_pop_guard(_PyUOpInstruction *this_instr, bool exit)
     }
 }
 
+/* Remove tuples that are unpacked as soon as they are built.
+ *
+ * The bytecode compiler already replaces BUILD_TUPLE immediately followed by
+ * UNPACK_SEQUENCE with SWAPs, but only within a basic block. In a trace, a
+ * branch like `a, b = (x, y) if c else (y, x)` becomes straight-line code,
+ * and the tuple built on the taken path never escapes.
+ *
+ * The only uops that may appear between the two are the _SET_IP and
+ * _CHECK_VALIDITY of the instruction doing the unpacking. If one of those
+ * exits, the tuple has to exist again, so we retarget it to the BUILD_TUPLE:
+ * the items are still on the stack, as tier one expects there.
+ */
+static void
+sink_tuples(_PyUOpInstruction *buffer, int buffer_size)
+{
+    for (int pc = 0; pc < buffer_size; pc++) {
+        _PyUOpInstruction *build = &buffer[pc];
+        if (is_terminator(build)) {
+            return;
+        }
+        if (build->opcode != _BUILD_TUPLE || build->oparg < 1 || build->oparg > 3) {
+            continue;
+        }
+        int unpack = pc + 1;
+        while (unpack < buffer_size) {
+            int opcode = buffer[unpack].opcode;
+            if (opcode != _NOP && opcode != _SET_IP &&
+                opcode != _CHECK_VALIDITY &&
+                opcode != _CHECK_VALIDITY_AND_SET_IP)
+            {
+                break;
+            }
+            unpack++;
+        }
+        if (unpack == buffer_size) {
+            return;
+        }
+        switch (buffer[unpack].opcode) {
+            case _UNPACK_SEQUENCE:
+            case _UNPACK_SEQUENCE_TWO_TUPLE:
+            case _UNPACK_SEQUENCE_TUPLE:
+                if (buffer[unpack].oparg == build->oparg) {
+                    break;
+                }
+                /* fall through */
+            default:
+                continue;
+        }
+        DPRINTF(2, "Removing tuple of %d built at %d\n", build->oparg, pc);
+        for (int i = pc + 1; i < unpack; i++) {
+            buffer[i].target = build->target;
+        }
+        /* The items are unpacked in reverse order */
+        if (build->oparg == 1) {
+            REPLACE_OP((&buffer[unpack]), _NOP, 0, 0);
+        }
+        else {
+            REPLACE_OP((&buffer[unpack]), _SWAP, build->oparg, 0);
+        }
+        REPLACE_OP(build, _NOP, 0, 0);
+        pc = unpack;
+    }
+}
+
+/* Fuse FOR_ITER over dict items, enumerate or zip with the UNPACK_SEQUENCE 2
+ * that follows it, so that the pair is pushed without building a tuple.
+ *
+ * As in sink_tuples, only the _SET_IP and _CHECK_VALIDITY of the unpacking
+ * instruction may appear in between. Once the pair is on the stack they can
+ * no longer exit to the UNPACK_SEQUENCE, so we retarget them to the
+ * instruction after it, which expects exactly that stack.
+ */
+static void
+fuse_pair_unpack(_PyUOpInstruction *buffer, int buffer_size)
+{
+    for (int pc = 0; pc < buffer_size - 1; pc++) {
+        _PyUOpInstruction *check = &buffer[pc];
+        if (is_terminator(check)) {
+            return;
+        }
+        uint16_t fused;
+        switch (check->opcode) {
+            case _ITER_CHECK_DICT_ITEMS:
+                fused = _FOR_ITER_DICT_ITEMS_UNPACKED;
+                break;
+            case _ITER_CHECK_ENUMERATE:
+                fused = _FOR_ITER_ENUMERATE_UNPACKED;
+                break;
+            case _ITER_CHECK_ZIP:
+                fused = _FOR_ITER_ZIP_UNPACKED;
+                break;
+            default:
+                continue;
+        }
+        _PyUOpInstruction *next = &buffer[pc + 1];
+        if (next->opcode != _FOR_ITER_TIER_TWO) {
+            continue;
+        }
+        int unpack = pc + 2;
+        while (unpack < buffer_size) {
+            int opcode = buffer[unpack].opcode;
+            if (opcode != _NOP && opcode != _SET_IP &&
+                opcode != _CHECK_VALIDITY &&
+                opcode != _CHECK_VALIDITY_AND_SET_IP)
+            {
+                break;
+            }
+            unpack++;
+        }
+        if (unpack == buffer_size) {
+            return;
+        }
+        switch (buffer[unpack].opcode) {
+            case _UNPACK_SEQUENCE:
+            case _UNPACK_SEQUENCE_TWO_TUPLE:
+            case _UNPACK_SEQUENCE_TUPLE:
+                if (buffer[unpack].oparg == 2) {
+                    break;
+                }
+                /* fall through */
+            default:
+                continue;
+        }
+        DPRINTF(2, "Fusing pair iterator at %d with unpack at %d\n", pc + 1, unpack);
+        int skip = 1 + INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE;
+        uint32_t target = buffer[unpack].target + skip;
+        for (int i = pc + 2; i < unpack; i++) {
+            buffer[i].target = target;
+            if (buffer[i].opcode == _SET_IP ||
+                buffer[i].opcode == _CHECK_VALIDITY_AND_SET_IP)
+            {
+                buffer[i].operand0 += skip * sizeof(_Py_CODEUNIT);
+            }
+        }
+        next->opcode = fused;
+        REPLACE_OP((&buffer[unpack]), _NOP, 0, 0);
+        pc = unpack;
+    }
+}
+
+/* Number of items a uop that may sit between the pieces of an f-string
+ * pushes, or -1 if it ends the search for FORMAT_SIMPLEs to fuse. */
+static int
+format_piece_pushes(int opcode)
+{
+    switch (opcode) {
+        case _NOP:
+        case _SET_IP:
+        case _CHECK_VALIDITY:
+        case _CHECK_VALIDITY_AND_SET_IP:
+            return 0;
+        case _LOAD_FAST:
+        case _LOAD_CONST:
+        case _LOAD_CONST_IMMORTAL:
+        case _LOAD_CONST_INLINE:
+        case _LOAD_CONST_INLINE_BORROW:
+        case _LOAD_SMALL_INT:
+            return 1;
+        case _LOAD_FAST_LOAD_FAST:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
+/* An f-string such as f"{x}: {y}" compiles to
+ *     LOAD_FAST x; FORMAT_SIMPLE; LOAD_CONST ": "; LOAD_FAST y;
+ *     FORMAT_SIMPLE; BUILD_STRING 3
+ * which creates a temporary string for every replacement field. Walking
+ * back from the _BUILD_STRING over loads that cannot fail, we remove the
+ * _FORMAT_SIMPLEs and record the pieces they applied to in the operand of
+ * a _BUILD_STRING_FORMAT, which formats ints, floats and strs straight into
+ * the result.
+ *
+ * Only side-effect free loads may appear between a removed _FORMAT_SIMPLE
+ * and the _BUILD_STRING, so the formatting can be delayed without changing
+ * behavior. Nothing escapes there any more either, and the _CHECK_VALIDITYs
+ * in that range, which would exit with unformatted pieces on the stack,
+ * are dropped.
+ */
+static void
+fuse_format_pieces(_PyUOpInstruction *buffer, int buffer_size)
+{
+    for (int pc = 0; pc < buffer_size; pc++) {
+        _PyUOpInstruction *build = &buffer[pc];
+        if (is_terminator(build)) {
+            return;
+        }
+        // The tier 2 interpreter and the JIT read the mask as a
+        // pointer-sized operand, so it only has that many bits:
+        if (build->opcode != _BUILD_STRING ||
+            build->oparg > (int)(8 * sizeof(uintptr_t)))
+        {
+            continue;
+        }
+        uint64_t format_mask = 0;
+        int first = pc;
+        int depth = 0;
+        for (int i = pc - 1; i >= 0 && depth < build->oparg; i--) {
+            int opcode = buffer[i].opcode;
+            if (opcode == _FORMAT_SIMPLE) {
+                format_mask |= (uint64_t)1 << (build->oparg - 1 - depth);
+                first = i;
+                continue;
+            }
+            int pushes = format_piece_pushes(opcode);
+            if (pushes < 0) {
+                break;
+            }
+            depth += pushes;
+        }
+        if (format_mask == 0) {
+            continue;
+        }
+        DPRINTF(2, "Fusing string of %d built at %d\n", build->oparg, pc);
+        for (int i = first; i < pc; i++) {
+            switch (buffer[i].opcode) {
+                case _FORMAT_SIMPLE:
+                case _CHECK_VALIDITY:
+                    buffer[i].opcode = _NOP;
+                    break;
+                case _CHECK_VALIDITY_AND_SET_IP:
+                    buffer[i].opcode = _SET_IP;
+                    break;
+            }
+        }
+        REPLACE_OP(build, _BUILD_STRING_FORMAT, build->oparg, format_mask);
+    }
+}
+
 /* _PUSH_FRAME/_RETURN_VALUE's operand can be 0, a PyFunctionObject *, or a
  * PyCodeObject *. Retrieve the code object if possible.
  */
@@ -449,6 +679,186 @@ get_code_with_logging(_PyUOpInstruction *op)
     return co;
 }
 
+/* Stack effect of the micro-ops that can appear in the body of an inlined
+ * callee. Returns false for anything else: anything that can escape or
+ * raise, or that needs the callee's frame for more than its arguments. */
+static bool
+inlined_stack_effect(_PyUOpInstruction *inst, int *popped, int *pushed)
+{
+    *popped = 0;
+    *pushed = 0;
+    switch (inst->opcode) {
+        case _NOP:
+        case _SET_IP:
+        case _CHECK_VALIDITY:
+        case _CHECK_VALIDITY_AND_SET_IP:
+        case _RESUME_CHECK:
+        case _TIER2_RESUME_CHECK:
+            return true;
+        case _LOAD_FAST:
+        case _LOAD_CONST_INLINE:
+        case _LOAD_CONST_INLINE_BORROW:
+        case _LOAD_SMALL_INT:
+            *pushed = 1;
+            return true;
+        case _POP_TOP:
+            *popped = 1;
+            return true;
+        case _GUARD_TYPE_VERSION:
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES:
+        case _CHECK_ATTR_CLASS:
+        case _GUARD_DORV_NO_DICT:
+        case _POP_TOP_LOAD_CONST_INLINE_BORROW:
+            *popped = 1;
+            *pushed = 1;
+            return true;
+        case _LOAD_ATTR_INSTANCE_VALUE:
+        case _LOAD_ATTR_SLOT:
+        case _LOAD_ATTR_CLASS:
+            *popped = 1;
+            *pushed = 1 + (inst->oparg & 1);
+            return true;
+    }
+    return false;
+}
+
+/* Inline a call to a simple Python function.
+ *
+ * If the traced body of a callee pushed by _INIT_CALL_PY_EXACT_ARGS does
+ * nothing but load its arguments and constants, check types and load
+ * attributes, it cannot escape, so its frame can only be observed if one
+ * of its guards fails. In that case we drop the frame push and pop, and
+ * loads of arguments become _COPYs from the caller's stack.
+ *
+ * The callee's resume check is moved in front of the body and retargeted
+ * to the call, so that it deopts with the call's inputs still on the stack
+ * and tier one makes the call itself. Since the body cannot escape,
+ * checking before it is as good as checking inside it.
+ *
+ * If nothing else in the body can deopt, the call becomes _ENTER_INLINED,
+ * which drops the already checked function, and _RETURN_VALUE becomes
+ * _RETURN_INLINED, which releases the arguments.
+ *
+ * Otherwise the call becomes _ENTER_GUARDED_INLINED and _RETURN_VALUE
+ * becomes _RETURN_GUARDED_INLINED, and the call's inputs stay on the stack
+ * until the body is done. The guards in the body keep their targets in the
+ * callee, and prepare_for_execution() gives them exit stubs that start with
+ * _MATERIALIZE_INLINED_FRAME, so the frame is only made if one of them
+ * fails.
+ *
+ * Called by _RETURN_VALUE, once the callee's abstract frame has been popped.
+ */
+static void
+inline_call(_Py_UOpsContext *ctx, _PyUOpInstruction *ret)
+{
+    assert(ret->opcode == _RETURN_VALUE);
+    int popped, pushed;
+    _PyUOpInstruction *push = ret - 1;
+    while (push->opcode != _PUSH_FRAME) {
+        if (!inlined_stack_effect(push, &popped, &pushed)) {
+            return;
+        }
+        push--;
+    }
+    _PyUOpInstruction *call = push - 2;
+    if (push[-1].opcode != _SAVE_RETURN_OFFSET ||
+        call->opcode != _INIT_CALL_PY_EXACT_ARGS) {
+        return;
+    }
+    /* The caller's stack still holds the call's inputs:
+     * callable, self_or_null, args[oparg]. */
+    _Py_UOpsAbstractFrame *caller = ctx->frame;
+    int first_local;
+    int argcount = call->oparg;
+    if (sym_is_null(caller->stack_pointer[1])) {
+        first_local = 1;
+    }
+    else if (sym_is_not_null(caller->stack_pointer[1])) {
+        first_local = 0;
+        argcount++;
+    }
+    else {
+        return;
+    }
+    bool guarded = false;
+    int depth = 0;
+    int max_depth = 0;
+    for (_PyUOpInstruction *inst = push + 1; inst < ret; inst++) {
+        inlined_stack_effect(inst, &popped, &pushed);
+        if (inst->opcode == _LOAD_FAST && inst->oparg >= argcount) {
+            return;
+        }
+        if (inst->opcode != _RESUME_CHECK &&
+            inst->opcode != _TIER2_RESUME_CHECK &&
+            inst->opcode != _CHECK_VALIDITY &&
+            inst->opcode != _CHECK_VALIDITY_AND_SET_IP &&
+            (_PyUop_Flags[inst->opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)))
+        {
+            guarded = true;
+        }
+        depth -= popped;
+        if (depth < 0) {
+            return;
+        }
+        depth += pushed;
+        max_depth = Py_MAX(max_depth, depth);
+    }
+    if (depth != 1) {
+        return;
+    }
+    /* _MATERIALIZE_INLINED_FRAME sets the caller's return offset itself */
+    if (guarded && push[-1].oparg != 1 + INLINE_CACHE_ENTRIES_CALL) {
+        return;
+    }
+    /* Values pushed by the body now live on the caller's stack, above the
+     * arguments, and above the callable if it is kept */
+    int callable_level = (int)(caller->stack_pointer - caller->stack);
+    int level = callable_level + 1 + guarded + call->oparg;
+    if (level + max_depth > caller->stack_len) {
+        return;
+    }
+    DPRINTF(2, "Inlining call at %d\n", (int)(call->target));
+    int resume_check = _NOP;
+    depth = 0;
+    for (_PyUOpInstruction *inst = push + 1; inst < ret; inst++) {
+        inlined_stack_effect(inst, &popped, &pushed);
+        switch (inst->opcode) {
+            case _RESUME_CHECK:
+            case _TIER2_RESUME_CHECK:
+                resume_check = inst->opcode;
+                REPLACE_OP(inst, _NOP, 0, 0);
+                break;
+            case _NOP:
+            case _SET_IP:
+            case _CHECK_VALIDITY:
+            case _CHECK_VALIDITY_AND_SET_IP:
+                REPLACE_OP(inst, _NOP, 0, 0);
+                break;
+            case _LOAD_FAST:
+            {
+                int offset = first_local + inst->oparg;
+                REPLACE_OP(inst, _COPY, 1 + call->oparg + depth - offset, 0);
+                break;
+            }
+        }
+        depth += pushed - popped;
+    }
+    int oparg = call->oparg;
+    uint32_t call_target = call->target;
+    REPLACE_OP(call, resume_check, 0, 0);
+    REPLACE_OP((push - 1), _CHECK_VALIDITY, 0, 0);
+    (push - 1)->target = call_target;
+    if (guarded) {
+        REPLACE_OP(push, _ENTER_GUARDED_INLINED, oparg, callable_level);
+        push->operand1 = call_target;
+        REPLACE_OP(ret, _RETURN_GUARDED_INLINED, oparg, 0);
+    }
+    else {
+        REPLACE_OP(push, _ENTER_INLINED, oparg, 0);
+        REPLACE_OP(ret, _RETURN_INLINED, oparg, 0);
+    }
+}
+
 /* 1 for success, 0 for not ready, cannot error at the moment. */
 static int
 optimize_uops(
@@ -550,6 +960,207 @@ optimize_uops(
 }
 
 
+#define MAX_HOISTED_GUARDS 16
+
+/* Returns the local variable that `inst` overwrites or clears,
+ * or the second one for _STORE_FAST_STORE_FAST if `second` is set.
+ * Returns -1 if it doesn't write a local. */
+static int
+written_local(_PyUOpInstruction *inst, bool second)
+{
+    switch (inst->opcode) {
+        case _STORE_FAST:
+        case _LOAD_FAST_AND_CLEAR:
+        case _DELETE_FAST:
+        case _MAKE_CELL:
+            return second ? -1 : inst->oparg;
+        case _STORE_FAST_LOAD_FAST:
+            return second ? -1 : inst->oparg >> 4;
+        case _STORE_FAST_STORE_FAST:
+            return second ? (inst->oparg & 15) : inst->oparg >> 4;
+        default:
+            return -1;
+    }
+}
+
+/* Returns the local whose value is on top of the stack just before `pc`,
+ * or -1 if it isn't known to be a local. */
+static int
+local_on_top(_PyUOpInstruction *buffer, int pc)
+{
+    for (pc--; pc > 0; pc--) {
+        _PyUOpInstruction *inst = &buffer[pc];
+        switch (inst->opcode) {
+            case _NOP:
+            case _SET_IP:
+            case _CHECK_VALIDITY:
+            case _CHECK_VALIDITY_AND_SET_IP:
+                break;
+            case _LOAD_FAST:
+            case _LOAD_FAST_CHECK:
+                return inst->oparg;
+            case _LOAD_FAST_LOAD_FAST:
+                return inst->oparg & 15;
+            default:
+                return -1;
+        }
+    }
+    return -1;
+}
+
+/* Move guards that cannot fail once they have passed out of the loop body
+ * and into a preheader, which runs once per entry to the executor:
+ *
+ *   _START_EXECUTOR
+ *   <hoisted guards>
+ *   _MAKE_WARM          <- _JUMP_TO_TOP jumps here
+ *   ...
+ *   _JUMP_TO_TOP
+ *
+ * This covers _CHECK_FUNCTION for the root frame, whose function cannot
+ * change, and _GUARD_TYPE_VERSION on locals of the root frame that the loop
+ * never stores to. In the latter case the only way for the guard to start
+ * failing is for the type to be modified or for the object's __class__ to be
+ * assigned, and both invalidate the executor through
+ * _Py_Executors_InvalidateDependency. As for guards removed by optimize_uops,
+ * that is picked up by the next _CHECK_VALIDITY following an escape.
+ *
+ * Hoisted guards must not exit to the start of the trace, as that is the
+ * ENTER_EXECUTOR for this executor. Instead they exit to the second
+ * instruction, so we only hoist if the first instruction does nothing
+ * but check the eval breaker (i.e. it is the JUMP_BACKWARD the trace
+ * started at). As _CHECK_PERIODIC escapes, this also guarantees that every
+ * iteration starts with a _CHECK_VALIDITY. */
+static void
+hoist_invariant_guards(_PyUOpInstruction *buffer, int buffer_size)
+{
+    if (buffer_size < 3 || buffer[1].opcode != _MAKE_WARM) {
+        return;
+    }
+    uint32_t start = buffer[0].target;
+    uint32_t exit_target = start;
+    bool periodic = false;
+    int end = -1;
+    for (int pc = 2; pc < buffer_size; pc++) {
+        _PyUOpInstruction *inst = &buffer[pc];
+        if (is_terminator(inst)) {
+            if (inst->opcode == _JUMP_TO_TOP) {
+                end = pc;
+            }
+            break;
+        }
+        if (exit_target == start) {
+            if (inst->target != start) {
+                exit_target = inst->target;
+                continue;
+            }
+            switch (inst->opcode) {
+                case _NOP:
+                case _SET_IP:
+                case _CHECK_VALIDITY:
+                case _CHECK_VALIDITY_AND_SET_IP:
+                    break;
+                case _CHECK_PERIODIC:
+                    periodic = true;
+                    break;
+                default:
+                    return;
+            }
+        }
+    }
+    if (end < 0 || exit_target == start || !periodic) {
+        return;
+    }
+    /* Find the guards to hoist, in the root frame only */
+    int hoisted[MAX_HOISTED_GUARDS];
+    int count = 0;
+    int depth = 0;
+    for (int pc = 2; pc < end && count < MAX_HOISTED_GUARDS; pc++) {
+        _PyUOpInstruction *inst = &buffer[pc];
+        switch (inst->opcode) {
+            case _PUSH_FRAME:
+                depth++;
+                break;
+            case _RETURN_VALUE:
+            case _RETURN_GENERATOR:
+            case _YIELD_VALUE:
+                if (--depth < 0) {
+                    /* The loop leaves the frame it started in */
+                    return;
+                }
+                break;
+            case _CHECK_FUNCTION:
+                if (depth == 0) {
+                    hoisted[count++] = pc;
+                }
+                break;
+            case _GUARD_TYPE_VERSION:
+            {
+                if (depth != 0 ||
+                    _PyType_LookupByVersion((uint32_t)inst->operand0) == NULL)
+                {
+                    /* Not watched, see _GUARD_TYPE_VERSION in
+                     * optimizer_bytecodes.c */
+                    break;
+                }
+                int local = local_on_top(buffer, pc);
+                if (local < 0) {
+                    break;
+                }
+                int d = 0;
+                for (int i = 2; i < end; i++) {
+                    if (buffer[i].opcode == _PUSH_FRAME) {
+                        d++;
+                    }
+                    else if (buffer[i].opcode == _RETURN_VALUE ||
+                             buffer[i].opcode == _RETURN_GENERATOR ||
+                             buffer[i].opcode == _YIELD_VALUE)
+                    {
+                        d--;
+                    }
+                    else if (d == 0 &&
+                             (written_local(&buffer[i], false) == local ||
+                              written_local(&buffer[i], true) == local))
+                    {
+                        local = -1;
+                        break;
+                    }
+                }
+                if (local >= 0) {
+                    inst->opcode = _GUARD_LOCAL_TYPE_VERSION;
+                    inst->oparg = local;
+                    hoisted[count++] = pc;
+                }
+                break;
+            }
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+    DPRINTF(2, "Hoisting %d guards out of the loop\n", count);
+    /* Shift everything up to the last hoisted guard down,
+     * dropping the hoisted guards, to make room for them
+     * after _START_EXECUTOR. */
+    _PyUOpInstruction guards[MAX_HOISTED_GUARDS];
+    int dest = hoisted[count-1];
+    int next = count - 1;
+    for (int pc = hoisted[count-1]; pc >= 1; pc--) {
+        if (next >= 0 && pc == hoisted[next]) {
+            guards[next--] = buffer[pc];
+        }
+        else {
+            buffer[dest--] = buffer[pc];
+        }
+    }
+    assert(dest == count);
+    for (int i = 0; i < count; i++) {
+        guards[i].target = exit_target;
+        buffer[1 + i] = guards[i];
+    }
+    assert(buffer[count + 1].opcode == _MAKE_WARM);
+}
+
 static int
 remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
 {
@@ -654,6 +1265,10 @@ _Py_uop_analyze_and_optimize(
         return err;
     }
 
+    sink_tuples(buffer, length);
+    fuse_pair_unpack(buffer, length);
+    fuse_format_pieces(buffer, length);
+
     length = optimize_uops(
         _PyFrame_GetCode(frame), buffer,
         length, curr_stacklen, dependencies);
@@ -662,6 +1277,8 @@ _Py_uop_analyze_and_optimize(
         return length;
     }
 
+    hoist_invariant_guards(buffer, length);
+
     length = remove_unneeded_uops(buffer, length);
     assert(length > 0);
 
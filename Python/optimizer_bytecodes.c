@@ -316,6 +316,26 @@ dummy_func(void) {
         }
     }
 
+    op(_GUARD_UNICODE_FORMAT, (left, right -- left, right)) {
+        PyTypeObject *rtype = sym_get_type(right);
+        if (sym_matches_type(left, &PyUnicode_Type) && rtype != NULL &&
+            (rtype == &PyUnicode_Type ||
+             !(rtype->tp_flags & Py_TPFLAGS_UNICODE_SUBCLASS)))
+        {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(left, &PyUnicode_Type);
+    }
+
+    op(_BINARY_OP_REMAINDER_UNICODE, (left, right -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
+    op(_BUILD_STRING_FORMAT, (format_mask/4, pieces[oparg] -- str)) {
+        (void)format_mask;
+        str = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
     op(_BINARY_OP_ADD_UNICODE, (left, right -- res)) {
         if (sym_is_const(left) && sym_is_const(right) &&
             sym_matches_type(left, &PyUnicode_Type) && sym_matches_type(right, &PyUnicode_Type)) {
@@ -427,6 +447,29 @@ dummy_func(void) {
         res = sym_new_type(ctx, &PyBool_Type);
     }
 
+    op(_COMPARE_OP_INT_FLOAT, (left, right -- res)) {
+        (void)left;
+        (void)right;
+        res = sym_new_type(ctx, &PyBool_Type);
+    }
+
+    op(_COMPARE_OP_BYTES, (left, right -- res)) {
+        (void)left;
+        (void)right;
+        res = sym_new_type(ctx, &PyBool_Type);
+    }
+
+    op(_COMPARE_OP_TUPLE, (left, right -- res)) {
+        (void)left;
+        (void)right;
+        if (oparg & 16) {
+            res = sym_new_type(ctx, &PyBool_Type);
+        }
+        else {
+            res = _Py_uop_sym_new_not_null(ctx);
+        }
+    }
+
     op(_IS_OP, (left, right -- res)) {
         (void)left;
         (void)right;
@@ -556,6 +599,31 @@ dummy_func(void) {
         (void)owner;
     }
 
+    op(_GUARD_SHAPE_VERSION_0, (type_version/2, owner -- owner, shape_index)) {
+        (void)type_version;
+        shape_index = sym_new_not_null(ctx);
+    }
+
+    op(_GUARD_SHAPE_VERSION_1, (type_version/2, owner, index -- owner, shape_index)) {
+        (void)type_version;
+        (void)index;
+        shape_index = sym_new_not_null(ctx);
+    }
+
+    op(_GUARD_SHAPE_VERSION_2, (type_version/2, owner, index -- owner, shape_index)) {
+        (void)type_version;
+        (void)index;
+        shape_index = sym_new_not_null(ctx);
+    }
+
+    op(_LOAD_ATTR_POLYMORPHIC, (shapes/2, owner, shape_index -- attr, null if (oparg & 1))) {
+        attr = sym_new_not_null(ctx);
+        null = sym_new_null(ctx);
+        (void)shapes;
+        (void)owner;
+        (void)shape_index;
+    }
+
     op(_LOAD_ATTR_CLASS, (descr/4, owner -- attr, null if (oparg & 1))) {
         attr = sym_new_not_null(ctx);
         null = sym_new_null(ctx);
@@ -566,18 +634,21 @@ dummy_func(void) {
     op(_LOAD_ATTR_METHOD_WITH_VALUES, (descr/4, owner -- attr, self if (1))) {
         (void)descr;
         attr = sym_new_not_null(ctx);
+        sym_set_non_null(owner);
         self = owner;
     }
 
     op(_LOAD_ATTR_METHOD_NO_DICT, (descr/4, owner -- attr, self if (1))) {
         (void)descr;
         attr = sym_new_not_null(ctx);
+        sym_set_non_null(owner);
         self = owner;
     }
 
     op(_LOAD_ATTR_METHOD_LAZY_DICT, (descr/4, owner -- attr, self if (1))) {
         (void)descr;
         attr = sym_new_not_null(ctx);
+        sym_set_non_null(owner);
         self = owner;
     }
 
@@ -721,6 +792,7 @@ dummy_func(void) {
         }
         RELOAD_STACK();
         res = retval;
+        inline_call(ctx, this_instr);
     }
 
     op(_RETURN_GENERATOR, ( -- res)) {
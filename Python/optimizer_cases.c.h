@@ -506,6 +506,31 @@
             break;
         }
 
+        case _GUARD_UNICODE_FORMAT: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyTypeObject *rtype = sym_get_type(right);
+            if (sym_matches_type(left, &PyUnicode_Type) && rtype != NULL &&
+                (rtype == &PyUnicode_Type ||
+                    !(rtype->tp_flags & Py_TPFLAGS_UNICODE_SUBCLASS)))
+            {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(left, &PyUnicode_Type);
+            break;
+        }
+
+        case _BINARY_OP_REMAINDER_UNICODE: {
+            _Py_UopsSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _BINARY_OP_INPLACE_ADD_UNICODE: {
             _Py_UopsSymbol *right;
             _Py_UopsSymbol *left;
@@ -696,6 +721,7 @@
             stack_pointer[0] = res;
             stack_pointer += 1;
             assert(WITHIN_STACK_BOUNDS());
+            inline_call(ctx, this_instr);
             break;
         }
 
@@ -987,6 +1013,17 @@
             break;
         }
 
+        case _BUILD_STRING_FORMAT: {
+            _Py_UopsSymbol *str;
+            PyObject *format_mask = (PyObject *)this_instr->operand0;
+            (void)format_mask;
+            str = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-oparg] = str;
+            stack_pointer += 1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _BUILD_TUPLE: {
             _Py_UopsSymbol *tup;
             tup = sym_new_not_null(ctx);
@@ -1146,6 +1183,61 @@
             break;
         }
 
+        case _GUARD_SHAPE_VERSION_0: {
+            _Py_UopsSymbol *shape_index;
+            uint32_t type_version = (uint32_t)this_instr->operand0;
+            (void)type_version;
+            shape_index = sym_new_not_null(ctx);
+            stack_pointer[0] = shape_index;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _GUARD_SHAPE_VERSION_1: {
+            _Py_UopsSymbol *index;
+            _Py_UopsSymbol *shape_index;
+            index = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)this_instr->operand0;
+            (void)type_version;
+            (void)index;
+            shape_index = sym_new_not_null(ctx);
+            stack_pointer[-1] = shape_index;
+            break;
+        }
+
+        case _GUARD_SHAPE_VERSION_2: {
+            _Py_UopsSymbol *index;
+            _Py_UopsSymbol *shape_index;
+            index = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)this_instr->operand0;
+            (void)type_version;
+            (void)index;
+            shape_index = sym_new_not_null(ctx);
+            stack_pointer[-1] = shape_index;
+            break;
+        }
+
+        case _LOAD_ATTR_POLYMORPHIC: {
+            _Py_UopsSymbol *shape_index;
+            _Py_UopsSymbol *owner;
+            _Py_UopsSymbol *attr;
+            _Py_UopsSymbol *null = NULL;
+            shape_index = stack_pointer[-1];
+            owner = stack_pointer[-2];
+            uint32_t shapes = (uint32_t)this_instr->operand0;
+            attr = sym_new_not_null(ctx);
+            null = sym_new_null(ctx);
+            (void)shapes;
+            (void)owner;
+            (void)shape_index;
+            stack_pointer[-2] = attr;
+            if (oparg & 1) stack_pointer[-1] = null;
+            stack_pointer += -1 + (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_ATTR_MODULE_PUSH_KEYS: {
             _Py_UopsSymbol *owner;
             _Py_UopsSymbol *mod_keys;
@@ -1383,6 +1475,60 @@
             break;
         }
 
+        case _COMPARE_OP_INT_FLOAT: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)left;
+            (void)right;
+            res = sym_new_type(ctx, &PyBool_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_BYTES: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)left;
+            (void)right;
+            res = sym_new_type(ctx, &PyBool_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_TUPLE: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)left;
+            (void)right;
+            if (oparg & 16) {
+                res = sym_new_type(ctx, &PyBool_Type);
+            }
+            else {
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                res = _Py_uop_sym_new_not_null(ctx);
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+            }
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _IS_OP: {
             _Py_UopsSymbol *right;
             _Py_UopsSymbol *left;
@@ -1431,6 +1577,15 @@
             break;
         }
 
+        case _CONTAINS_OP_TUPLE: {
+            _Py_UopsSymbol *b;
+            b = sym_new_not_null(ctx);
+            stack_pointer[-2] = b;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_EG_MATCH: {
             _Py_UopsSymbol *rest;
             _Py_UopsSymbol *match;
@@ -1615,6 +1770,54 @@
             break;
         }
 
+        case _ITER_CHECK_DICT_ITEMS: {
+            break;
+        }
+
+        case _ITER_CHECK_ENUMERATE: {
+            break;
+        }
+
+        case _ITER_CHECK_ZIP: {
+            break;
+        }
+
+        case _FOR_ITER_DICT_ITEMS_UNPACKED: {
+            _Py_UopsSymbol *value;
+            _Py_UopsSymbol *key;
+            value = sym_new_not_null(ctx);
+            key = sym_new_not_null(ctx);
+            stack_pointer[0] = value;
+            stack_pointer[1] = key;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FOR_ITER_ENUMERATE_UNPACKED: {
+            _Py_UopsSymbol *item;
+            _Py_UopsSymbol *index;
+            item = sym_new_not_null(ctx);
+            index = sym_new_not_null(ctx);
+            stack_pointer[0] = item;
+            stack_pointer[1] = index;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FOR_ITER_ZIP_UNPACKED: {
+            _Py_UopsSymbol *second;
+            _Py_UopsSymbol *first;
+            second = sym_new_not_null(ctx);
+            first = sym_new_not_null(ctx);
+            stack_pointer[0] = second;
+            stack_pointer[1] = first;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _LOAD_SPECIAL: {
             _Py_UopsSymbol *owner;
             _Py_UopsSymbol *attr;
@@ -1667,6 +1870,7 @@
             PyObject *descr = (PyObject *)this_instr->operand0;
             (void)descr;
             attr = sym_new_not_null(ctx);
+            sym_set_non_null(owner);
             self = owner;
             stack_pointer[-1] = attr;
             stack_pointer[0] = self;
@@ -1683,6 +1887,7 @@
             PyObject *descr = (PyObject *)this_instr->operand0;
             (void)descr;
             attr = sym_new_not_null(ctx);
+            sym_set_non_null(owner);
             self = owner;
             stack_pointer[-1] = attr;
             stack_pointer[0] = self;
@@ -1717,6 +1922,7 @@
             PyObject *descr = (PyObject *)this_instr->operand0;
             (void)descr;
             attr = sym_new_not_null(ctx);
+            sym_set_non_null(owner);
             self = owner;
             stack_pointer[-1] = attr;
             stack_pointer[0] = self;
@@ -2197,6 +2403,24 @@
             break;
         }
 
+        case _CALL_KW_BUILTIN_FAST: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         /* _INSTRUMENTED_CALL_FUNCTION_EX is not a viable micro-op for tier 2 */
 
         case _MAKE_CALLARGS_A_TUPLE: {
@@ -2211,6 +2435,19 @@
 
         /* _DO_CALL_FUNCTION_EX is not a viable micro-op for tier 2 */
 
+        case _CHECK_IS_NOT_PY_CALLABLE_EX: {
+            break;
+        }
+
+        case _CALL_FUNCTION_EX_NON_PY: {
+            _Py_UopsSymbol *result;
+            result = sym_new_not_null(ctx);
+            stack_pointer[-3 - (oparg & 1)] = result;
+            stack_pointer += -2 - (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _MAKE_FUNCTION: {
             _Py_UopsSymbol *func;
             func = sym_new_not_null(ctx);
@@ -2501,6 +2738,41 @@
             break;
         }
 
+        case _ENTER_INLINED: {
+            _Py_UopsSymbol *self_or_null_out;
+            self_or_null_out = sym_new_not_null(ctx);
+            stack_pointer[-2 - oparg] = self_or_null_out;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _RETURN_INLINED: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-2 - oparg] = res;
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ENTER_GUARDED_INLINED: {
+            break;
+        }
+
+        case _RETURN_GUARDED_INLINED: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _MATERIALIZE_INLINED_FRAME: {
+            break;
+        }
+
         case _LOAD_CONST_INLINE_WITH_NULL: {
             _Py_UopsSymbol *value;
             _Py_UopsSymbol *null;
@@ -2531,6 +2803,10 @@
             break;
         }
 
+        case _GUARD_LOCAL_TYPE_VERSION: {
+            break;
+        }
+
         case _LOAD_GLOBAL_MODULE: {
             _Py_UopsSymbol *res;
             _Py_UopsSymbol *null = NULL;
@@ -15,6 +15,7 @@
 #include "pycore_global_objects_fini_generated.h"  // "_PyStaticObjects_CheckRefcnt()
 #include "pycore_import.h"        // _PyImport_BootstrapImp()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
+#include "pycore_jit.h"           // _PyJIT_Fini()
 #include "pycore_list.h"          // _PyList_Fini()
 #include "pycore_long.h"          // _PyLong_InitTypes()
 #include "pycore_object.h"        // _PyDebug_PrintTotalRefs()
@@ -1296,19 +1297,6 @@ init_interp_main(PyThreadState *tstate)
         interp->runtime->initialized = 1;
     }
 
-    if (config->site_import) {
-        status = init_import_site();
-        if (_PyStatus_EXCEPTION(status)) {
-            return status;
-        }
-    }
-
-    if (is_main_interp) {
-#ifndef MS_WINDOWS
-        emit_stderr_warning_for_legacy_locale(interp->runtime);
-#endif
-    }
-
     // Turn on experimental tier 2 (uops-based) optimizer
     // This is also needed when the JIT is enabled
 #ifdef _Py_TIER2
@@ -1322,6 +1310,34 @@ init_interp_main(PyThreadState *tstate)
             // PYTHON_JIT=0|1 overrides the default
             enabled = *env != '0';
         }
+        env = Py_GETENV("PYTHON_JIT_THRESHOLD");
+        if (env && *env != '\0') {
+            // Number of times a loop has to run before it is traced.
+            // Read before site is imported, so that it applies to site,
+            // sitecustomize and everything imported after them.
+            char *endptr;
+            errno = 0;
+            unsigned long threshold = strtoul(env, &endptr, 10);
+            if (*endptr != '\0' || errno == ERANGE
+                || threshold < 1 || threshold > JUMP_BACKWARD_INITIAL_VALUE + 1)
+            {
+                return _PyStatus_ERR("PYTHON_JIT_THRESHOLD must be "
+                                     "an integer in range [1; 4096]");
+            }
+            interp->jump_backward_initial_value = (uint16_t)(threshold - 1);
+        }
+#ifdef _Py_JIT
+        // Compile executors on a worker thread. Without the JIT there is
+        // nothing for it to do, and executors would only be installed later.
+        env = Py_GETENV("PYTHON_JIT_BACKGROUND");
+        if (enabled && env && *env != '\0' && *env != '0'
+            && config->perf_profiling <= 0)
+        {
+            if (_PyOptimizer_InitBackgroundCompiler(interp) < 0) {
+                return _PyStatus_NO_MEMORY();
+            }
+        }
+#endif
         if (enabled) {
 #ifdef _Py_JIT
             // perf profiler works fine with tier 2 interpreter, so
@@ -1347,6 +1363,19 @@ init_interp_main(PyThreadState *tstate)
     }
 #endif
 
+    if (config->site_import) {
+        status = init_import_site();
+        if (_PyStatus_EXCEPTION(status)) {
+            return status;
+        }
+    }
+
+    if (is_main_interp) {
+#ifndef MS_WINDOWS
+        emit_stderr_warning_for_legacy_locale(interp->runtime);
+#endif
+    }
+
     if (!is_main_interp) {
         // The main interpreter is handled in Py_Main(), for now.
         if (config->sys_path_0 != NULL) {
@@ -1706,7 +1735,9 @@ finalize_modules(PyThreadState *tstate)
     PyInterpreterState *interp = tstate->interp;
 
 #ifdef _Py_TIER2
-    // Invalidate all executors and turn off tier 2 optimizer
+    // Stop the background compiler, invalidate all executors and turn off
+    // tier 2 optimizer
+    _PyOptimizer_FiniBackgroundCompiler(interp);
     _Py_Executors_InvalidateAll(interp, 0);
     _PyOptimizerObject *old = _Py_SetOptimizer(interp, NULL);
     Py_XDECREF(old);
@@ -2039,6 +2070,9 @@ _Py_Finalize(_PyRuntimeState *runtime)
 
     _PyAtExit_Call(tstate->interp);
 
+    // Stop the background marking thread before other threads are detached
+    _PyGC_FiniBackgroundMarking(tstate->interp);
+
     assert(_PyThreadState_GET() == tstate);
 
     /* Copy the core config, PyInterpreterState_Delete() free
@@ -2227,6 +2261,11 @@ _Py_Finalize(_PyRuntimeState *runtime)
 
     finalize_interp_delete(tstate->interp);
 
+#ifdef _Py_JIT
+    // The executors sharing the JIT's executable memory are gone now
+    _PyJIT_Fini();
+#endif
+
 #ifdef Py_REF_DEBUG
     if (show_ref_count) {
         _PyDebug_PrintTotalRefs();
@@ -5,6 +5,7 @@
 #include "pycore_code.h"
 #include "pycore_descrobject.h"   // _PyMethodWrapper_Type
 #include "pycore_dict.h"          // DICT_KEYS_UNICODE
+#include "pycore_frame.h"         // _PyInterpreterFrame
 #include "pycore_function.h"      // _PyFunction_GetVersionForCurrentState()
 #include "pycore_long.h"          // _PyLong_IsNonNegativeCompact()
 #include "pycore_moduleobject.h"
@@ -14,6 +15,7 @@
 #include "pycore_uop_ids.h"       // MAX_UOP_ID
 #include "pycore_opcode_utils.h"  // RESUME_AT_FUNC_START
 #include "pycore_pylifecycle.h"   // _PyOS_URandomNonblock()
+#include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_runtime.h"       // _Py_ID()
 
 #include <stdlib.h> // rand()
@@ -424,7 +426,7 @@ _Py_PrintSpecializationStats(int to_file)
     return 1;
 }
 
-#define SPECIALIZATION_FAIL(opcode, kind) \
+#define SPECIALIZATION_STATS_FAIL(opcode, kind) \
 do { \
     if (_Py_stats) { \
         _Py_stats->opcode_stats[opcode].specialization.failure_kinds[kind]++; \
@@ -434,9 +436,169 @@ do { \
 #endif  // Py_STATS
 
 
-#ifndef SPECIALIZATION_FAIL
-#  define SPECIALIZATION_FAIL(opcode, kind) ((void)0)
+#ifndef SPECIALIZATION_STATS_FAIL
+#  define SPECIALIZATION_STATS_FAIL(opcode, kind) ((void)0)
+#endif
+
+#ifdef SPECIALIZATION_FAILURE_KINDS
+static_assert(SPECIALIZATION_FAILURE_KINDS == SPEC_FAILURE_KINDS,
+              "SPECIALIZATION_FAILURE_KINDS and SPEC_FAILURE_KINDS are out of sync");
+#endif
+
+/* Specialization failures can be sampled at runtime in every build, see
+ * _Py_SetSpecializationFailureSampling(). The kind is only computed when
+ * something is going to record it, since classifying a failure can be
+ * much more expensive than the failed specialization attempt itself.
+ */
+static void record_specialization_failure(int opcode, int kind);
+
+#define SPECIALIZATION_FAIL(opcode, kind) \
+do { \
+    if (_Py_SPEC_FAILURES_RECORDED()) { \
+        int kind_ = (kind); \
+        SPECIALIZATION_STATS_FAIL(opcode, kind_); \
+        record_specialization_failure(opcode, kind_); \
+    } \
+} while (0)
+
+#define _Py_SPEC_FAILURE_SAMPLE_RATE() \
+    FT_ATOMIC_LOAD_INT_RELAXED( \
+        _PyInterpreterState_GET()->code_state.spec_failures.sample_rate)
+
+#ifdef Py_STATS
+#  define _Py_SPEC_FAILURES_RECORDED() \
+    (_Py_stats != NULL || _Py_SPEC_FAILURE_SAMPLE_RATE() != 0)
+#else
+#  define _Py_SPEC_FAILURES_RECORDED() (_Py_SPEC_FAILURE_SAMPLE_RATE() != 0)
+#endif
+
+/* In the free-threaded build, several threads can record failures at once.
+ * The countdown and counts are then updated atomically, and the counts are
+ * published with release/acquire, since they are allocated when sampling is
+ * first enabled. Losing a reset of the countdown to a race only shifts
+ * which failure is sampled next. */
+static void
+record_specialization_failure(int opcode, int kind)
+{
+    struct _Py_spec_failure_state *state =
+        &_PyInterpreterState_GET()->code_state.spec_failures;
+    int sample_rate = FT_ATOMIC_LOAD_INT_RELAXED(state->sample_rate);
+    uint64_t (*counts)[SPEC_FAILURE_KINDS] =
+        FT_ATOMIC_LOAD_PTR_ACQUIRE(state->counts);
+    if (sample_rate == 0 || counts == NULL) {
+        return;
+    }
+    assert(0 <= kind && kind < SPEC_FAILURE_KINDS);
+#ifdef Py_GIL_DISABLED
+    if (_Py_atomic_add_int(&state->countdown, -1) > 1) {
+        return;
+    }
+    _Py_atomic_store_int_relaxed(&state->countdown, sample_rate);
+    _Py_atomic_add_uint64(&counts[opcode][kind], 1);
+#else
+    if (--state->countdown > 0) {
+        return;
+    }
+    state->countdown = sample_rate;
+    counts[opcode][kind]++;
+#endif
+
+    _PyInterpreterFrame *frame = _PyThreadState_GET()->current_frame;
+    if (frame == NULL || !PyCode_Check(PyStackRef_AsPyObjectBorrow(frame->f_executable))) {
+        return;
+    }
+    PyCodeObject *co = _PyFrame_GetCode(frame);
+    int offset = _PyInterpreterFrame_LASTI(frame);
+    if (offset < 0 || offset >= Py_SIZE(co)) {
+        return;
+    }
+    /* The failure is being recorded while specializing, which must not
+     * raise, so any error (e.g. a MemoryError) is dropped. */
+    PyObject *exc = PyErr_GetRaisedException();
+    if (_PyCode_RecordSpecializationFailure(co, offset, kind) < 0) {
+        PyErr_Clear();
+    }
+    PyErr_SetRaisedException(exc);
+}
+
+int
+_Py_SetSpecializationFailureSampling(int sample_rate)
+{
+    if (sample_rate < 0) {
+        PyErr_SetString(PyExc_ValueError, "sample rate must be >= 0");
+        return -1;
+    }
+    struct _py_code_state *code_state = &_PyInterpreterState_GET()->code_state;
+    struct _Py_spec_failure_state *state = &code_state->spec_failures;
+    PyMutex_Lock(&code_state->mutex);
+    if (sample_rate != 0 && state->counts == NULL) {
+        /* The counts are kept until the interpreter is finalized, so that
+         * they can still be read after sampling is disabled. */
+        void *counts = PyMem_RawCalloc(256, sizeof(*state->counts));
+        if (counts == NULL) {
+            PyMutex_Unlock(&code_state->mutex);
+            PyErr_NoMemory();
+            return -1;
+        }
+        FT_ATOMIC_STORE_PTR_RELEASE(state->counts, counts);
+    }
+    FT_ATOMIC_STORE_INT_RELAXED(state->countdown, sample_rate);
+    FT_ATOMIC_STORE_INT_RELAXED(state->sample_rate, sample_rate);
+    PyMutex_Unlock(&code_state->mutex);
+    return 0;
+}
+
+PyObject *
+_Py_GetSpecializationFailures(void)
+{
+    struct _Py_spec_failure_state *state =
+        &_PyInterpreterState_GET()->code_state.spec_failures;
+    uint64_t (*counts)[SPEC_FAILURE_KINDS] =
+        FT_ATOMIC_LOAD_PTR_ACQUIRE(state->counts);
+    PyObject *res = PyDict_New();
+    if (res == NULL || counts == NULL) {
+        return res;
+    }
+    for (int op = 0; op < 256; op++) {
+        PyObject *kinds = NULL;
+        for (int kind = 0; kind < SPEC_FAILURE_KINDS; kind++) {
+#ifdef Py_GIL_DISABLED
+            uint64_t n = _Py_atomic_load_uint64_relaxed(&counts[op][kind]);
+#else
+            uint64_t n = counts[op][kind];
 #endif
+            if (n == 0) {
+                continue;
+            }
+            if (kinds == NULL) {
+                kinds = PyDict_New();
+                if (kinds == NULL ||
+                    PyDict_SetItemString(res, _PyOpcode_OpName[op], kinds) < 0)
+                {
+                    goto error;
+                }
+            }
+            PyObject *key = PyLong_FromLong(kind);
+            PyObject *count = PyLong_FromUnsignedLongLong(n);
+            if (key == NULL || count == NULL ||
+                PyDict_SetItem(kinds, key, count) < 0)
+            {
+                Py_XDECREF(key);
+                Py_XDECREF(count);
+                goto error;
+            }
+            Py_DECREF(key);
+            Py_DECREF(count);
+        }
+        Py_XDECREF(kinds);
+        continue;
+error:
+        Py_XDECREF(kinds);
+        Py_DECREF(res);
+        return NULL;
+    }
+    return res;
+}
 
 // Initialize warmup counters and optimize instructions. This cannot fail.
 void
@@ -446,7 +608,8 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
     #if ENABLE_SPECIALIZATION_FT
     _Py_BackoffCounter jump_counter, adaptive_counter;
     if (enable_counters) {
-        jump_counter = initial_jump_backoff_counter();
+        jump_counter = initial_jump_backoff_counter(
+            _PyInterpreterState_GET()->jump_backward_initial_value);
         adaptive_counter = adaptive_counter_warmup();
     }
     else {
@@ -487,6 +650,18 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
                 instructions[i].op.code = LOAD_CONST_IMMORTAL;
             }
         }
+        else {
+            int next_opcode = instructions[i + 1].op.code;
+            int super_opcode = _PyOpcode_super_instruction(opcode, next_opcode);
+            if (super_opcode != opcode) {
+                /* The second instruction is left in place, so that it can
+                 * still be instrumented or jumped to on its own.
+                 * It must not start another superinstruction, as it
+                 * would then no longer be recognized. */
+                instructions[i].op.code = super_opcode;
+                i += 1 + _PyOpcode_Caches[next_opcode];
+            }
+        }
         if (opcode != EXTENDED_ARG) {
             oparg = 0;
         }
@@ -610,13 +785,14 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
 #define SPEC_FAIL_CALL_INIT_NOT_SIMPLE 30
 #define SPEC_FAIL_CALL_METACLASS 31
 #define SPEC_FAIL_CALL_INIT_NOT_INLINE_VALUES 32
+#define SPEC_FAIL_CALL_PYTHON_FUNCTION 33
+#define SPEC_FAIL_CALL_NO_VECTORCALL 34
 
 /* COMPARE_OP */
 #define SPEC_FAIL_COMPARE_OP_DIFFERENT_TYPES 12
 #define SPEC_FAIL_COMPARE_OP_STRING 13
 #define SPEC_FAIL_COMPARE_OP_BIG_INT 14
 #define SPEC_FAIL_COMPARE_OP_BYTES 15
-#define SPEC_FAIL_COMPARE_OP_TUPLE 16
 #define SPEC_FAIL_COMPARE_OP_LIST 17
 #define SPEC_FAIL_COMPARE_OP_SET 18
 #define SPEC_FAIL_COMPARE_OP_BOOL 19
@@ -666,10 +842,15 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
 
 // CONTAINS_OP
 #define SPEC_FAIL_CONTAINS_OP_STR        9
-#define SPEC_FAIL_CONTAINS_OP_TUPLE      10
 #define SPEC_FAIL_CONTAINS_OP_LIST       11
 #define SPEC_FAIL_CONTAINS_OP_USER_CLASS 12
 
+// Every kind needs a slot in struct _Py_spec_failure_state's counts.
+static_assert(SPEC_FAIL_ATTR_SPLIT_DICT < SPEC_FAILURE_KINDS,
+              "SPEC_FAILURE_KINDS is too small");
+static_assert(SPEC_FAIL_CALL_NO_VECTORCALL < SPEC_FAILURE_KINDS,
+              "SPEC_FAILURE_KINDS is too small");
+
 static inline int
 set_opcode(_Py_CODEUNIT *instr, uint8_t opcode)
 {
@@ -1268,6 +1449,99 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
     }
     return -1;
 }
+
+static_assert(sizeof(_PyAttrPolymorphicCache) <=
+              INLINE_CACHE_ENTRIES_LOAD_ATTR * sizeof(_Py_CODEUNIT),
+              "LOAD_ATTR_POLYMORPHIC's cache must fit in LOAD_ATTR's");
+
+/* Reads the receiver types and shapes cached by a LOAD_ATTR_INSTANCE_VALUE,
+ * LOAD_ATTR_SLOT or LOAD_ATTR_POLYMORPHIC into versions and shapes.
+ * Returns how many there are, which is 0 for any other instruction.
+ */
+static int
+get_attr_shapes(_Py_CODEUNIT *instr, uint32_t *versions, uint8_t *shapes)
+{
+    uint8_t flags;
+    switch (instr->op.code) {
+        case LOAD_ATTR_INSTANCE_VALUE:
+            flags = POLYMORPHIC_SHAPE_INLINE_VALUES;
+            break;
+        case LOAD_ATTR_SLOT:
+            flags = 0;
+            break;
+        case LOAD_ATTR_POLYMORPHIC:
+        {
+            _PyAttrPolymorphicCache *cache = (_PyAttrPolymorphicCache *)(instr + 1);
+            uint32_t packed = read_u32(cache->shapes);
+            int n = 0;
+            for (int i = 0; i < LOAD_ATTR_POLYMORPHIC_SHAPES; i++) {
+                uint32_t version = read_u32(cache->type_versions[i]);
+                if (version != 0) {
+                    versions[n] = version;
+                    shapes[n] = (uint8_t)(packed >> (8 * i));
+                    n++;
+                }
+            }
+            return n;
+        }
+        default:
+            return 0;
+    }
+    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+    size_t offset = cache->index / sizeof(PyObject *);
+    if (cache->index % sizeof(PyObject *) || offset > POLYMORPHIC_SHAPE_MAX_OFFSET) {
+        return 0;
+    }
+    versions[0] = read_u32(cache->version);
+    shapes[0] = flags | (uint8_t)offset;
+    return 1;
+}
+
+/* Combines the shape just specialized for with the n shapes that the
+ * instruction had cached before, dropping the oldest if there are too many.
+ */
+static void
+specialize_polymorphic_load_attr(_Py_CODEUNIT *instr, uint32_t *versions,
+                                 uint8_t *shapes, int n)
+{
+    if (instr->op.code != LOAD_ATTR_INSTANCE_VALUE &&
+        instr->op.code != LOAD_ATTR_SLOT)
+    {
+        return;
+    }
+    if (get_attr_shapes(instr, &versions[n], &shapes[n]) == 0) {
+        return;
+    }
+    uint32_t version = versions[n];
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (versions[i] != version) {
+            versions[count] = versions[i];
+            shapes[count] = shapes[i];
+            count++;
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+    versions[count] = version;
+    shapes[count] = shapes[n];
+    count++;
+    int first = count > LOAD_ATTR_POLYMORPHIC_SHAPES ? count - LOAD_ATTR_POLYMORPHIC_SHAPES : 0;
+    _PyAttrPolymorphicCache *cache = (_PyAttrPolymorphicCache *)(instr + 1);
+    uint32_t packed = 0;
+    for (int i = 0; i < LOAD_ATTR_POLYMORPHIC_SHAPES; i++) {
+        if (first + i < count) {
+            write_u32(cache->type_versions[i], versions[first + i]);
+            packed |= (uint32_t)shapes[first + i] << (8 * i);
+        }
+        else {
+            write_u32(cache->type_versions[i], 0);
+        }
+    }
+    write_u32(cache->shapes, packed);
+    specialize(instr, LOAD_ATTR_POLYMORPHIC);
+}
 #endif //  Py_GIL_DISABLED
 
 void
@@ -1302,7 +1576,14 @@ _Py_Specialize_LoadAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *nam
         SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_EXPECTED_ERROR);
         fail = true;
         #else
+        /* Room for the shapes already cached and the new one */
+        uint32_t versions[LOAD_ATTR_POLYMORPHIC_SHAPES + 1];
+        uint8_t shapes[LOAD_ATTR_POLYMORPHIC_SHAPES + 1];
+        int n = get_attr_shapes(instr, versions, shapes);
         fail = specialize_instance_load_attr(owner, instr, name);
+        if (!fail && n > 0) {
+            specialize_polymorphic_load_attr(instr, versions, shapes, n);
+        }
         #endif
     }
 
@@ -1413,7 +1694,6 @@ _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *na
 
 #ifndef Py_GIL_DISABLED
 
-#ifdef Py_STATS
 static int
 load_attr_fail_kind(DescriptorClassification kind)
 {
@@ -1448,7 +1728,6 @@ load_attr_fail_kind(DescriptorClassification kind)
     }
     Py_UNREACHABLE();
 }
-#endif   // Py_STATS
 
 static int
 specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
@@ -1502,11 +1781,9 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
                 specialize(instr, LOAD_ATTR_CLASS);
             }
             return 0;
-#ifdef Py_STATS
         case ABSENT:
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_EXPECTED_ERROR);
             return -1;
-#endif
         default:
             SPECIALIZATION_FAIL(LOAD_ATTR, load_attr_fail_kind(kind));
             return -1;
@@ -1695,7 +1972,6 @@ _Py_Specialize_LoadGlobal(
     Py_END_CRITICAL_SECTION2();
 }
 
-#ifdef Py_STATS
 static int
 binary_subscr_fail_kind(PyTypeObject *container_type, PyObject *sub)
 {
@@ -1724,7 +2000,6 @@ binary_subscr_fail_kind(PyTypeObject *container_type, PyObject *sub)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 static int
 function_kind(PyCodeObject *code) {
@@ -1886,7 +2161,6 @@ _Py_Specialize_BinarySubscr(
 }
 
 
-#ifdef Py_STATS
 static int
 store_subscr_fail_kind(PyObject *container, PyObject *sub)
 {
@@ -1949,7 +2223,6 @@ store_subscr_fail_kind(PyObject *container, PyObject *sub)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 void
 _Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_CODEUNIT *instr)
@@ -2297,6 +2570,19 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
             fail = -1;
         }
     }
+    else if (PyCFunction_CheckExact(callable) &&
+             PyCFunction_GET_FLAGS(callable) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_BUILTIN_FAST);
+        fail = 0;
+    }
+    else if (Py_IS_TYPE(callable, &PyMethodDescr_Type) &&
+             ((PyMethodDescrObject *)callable)->d_method->ml_flags ==
+                (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_METHOD_DESCRIPTOR_FAST);
+        fail = 0;
+    }
     else {
         specialize(instr, CALL_KW_NON_PY);
         fail = 0;
@@ -2306,7 +2592,27 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
     }
 }
 
-#ifdef Py_STATS
+void
+_Py_Specialize_CallFunctionEx(_PyStackRef func_st, _Py_CODEUNIT *instr)
+{
+    PyObject *func = PyStackRef_AsPyObjectBorrow(func_st);
+
+    assert(ENABLE_SPECIALIZATION_FT);
+    assert(_PyOpcode_Caches[CALL_FUNCTION_EX] == INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
+    /* Python functions get their frame pushed inline by the generic form */
+    if (PyFunction_Check(func)) {
+        SPECIALIZATION_FAIL(CALL_FUNCTION_EX, SPEC_FAIL_CALL_PYTHON_FUNCTION);
+        unspecialize(instr);
+        return;
+    }
+    if (PyVectorcall_Function(func) == NULL) {
+        SPECIALIZATION_FAIL(CALL_FUNCTION_EX, SPEC_FAIL_CALL_NO_VECTORCALL);
+        unspecialize(instr);
+        return;
+    }
+    specialize(instr, CALL_FUNCTION_EX_NON_PY);
+}
+
 static int
 binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
 {
@@ -2374,7 +2680,6 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
     }
     Py_UNREACHABLE();
 }
-#endif
 
 void
 _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *instr,
@@ -2437,13 +2742,22 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
                 return;
             }
             break;
+        case NB_REMAINDER:
+        case NB_INPLACE_REMAINDER:
+            /* str % x, unless x is a str subclass that may override __rmod__ */
+            if (PyUnicode_CheckExact(lhs) &&
+                (PyUnicode_CheckExact(rhs) || !PyUnicode_Check(rhs)))
+            {
+                specialize(instr, BINARY_OP_REMAINDER_UNICODE);
+                return;
+            }
+            break;
     }
     SPECIALIZATION_FAIL(BINARY_OP, binary_op_fail_kind(oparg, lhs, rhs));
     unspecialize(instr);
 }
 
 
-#ifdef Py_STATS
 static int
 compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
 {
@@ -2459,9 +2773,6 @@ compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
     if (PyBytes_CheckExact(lhs)) {
         return SPEC_FAIL_COMPARE_OP_BYTES;
     }
-    if (PyTuple_CheckExact(lhs)) {
-        return SPEC_FAIL_COMPARE_OP_TUPLE;
-    }
     if (PyList_CheckExact(lhs)) {
         return SPEC_FAIL_COMPARE_OP_LIST;
     }
@@ -2476,7 +2787,6 @@ compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 void
 _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *instr,
@@ -2490,6 +2800,17 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
     // All of these specializations compute boolean values, so they're all valid
     // regardless of the fifth-lowest oparg bit.
     _PyCompareOpCache *cache = (_PyCompareOpCache *)(instr + 1);
+    if ((PyLong_CheckExact(lhs) && PyFloat_CheckExact(rhs)) ||
+        (PyFloat_CheckExact(lhs) && PyLong_CheckExact(rhs)))
+    {
+        PyObject *int_o = PyLong_CheckExact(lhs) ? lhs : rhs;
+        if (_PyLong_IsCompact((PyLongObject *)int_o)) {
+            instr->op.code = COMPARE_OP_INT_FLOAT;
+            goto success;
+        }
+        SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
+        goto failure;
+    }
     if (Py_TYPE(lhs) != Py_TYPE(rhs)) {
         SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
         goto failure;
@@ -2519,6 +2840,19 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
             goto success;
         }
     }
+    if (PyBytes_CheckExact(lhs)) {
+        int cmp = oparg >> 5;
+        if (cmp != Py_EQ && cmp != Py_NE) {
+            SPECIALIZATION_FAIL(COMPARE_OP, SPEC_FAIL_COMPARE_OP_BYTES);
+            goto failure;
+        }
+        instr->op.code = COMPARE_OP_BYTES;
+        goto success;
+    }
+    if (PyTuple_CheckExact(lhs)) {
+        instr->op.code = COMPARE_OP_TUPLE;
+        goto success;
+    }
     SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
 failure:
     STAT_INC(COMPARE_OP, failure);
@@ -2530,7 +2864,6 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
     cache->counter = adaptive_counter_cooldown();
 }
 
-#ifdef Py_STATS
 static int
 unpack_sequence_fail_kind(PyObject *seq)
 {
@@ -2542,7 +2875,6 @@ unpack_sequence_fail_kind(PyObject *seq)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 void
 _Py_Specialize_UnpackSequence(_PyStackRef seq_st, _Py_CODEUNIT *instr, int oparg)
@@ -2578,7 +2910,6 @@ _Py_Specialize_UnpackSequence(_PyStackRef seq_st, _Py_CODEUNIT *instr, int oparg
     unspecialize(instr);
 }
 
-#ifdef Py_STATS
 int
  _PySpecialization_ClassifyIterator(PyObject *iter)
 {
@@ -2649,7 +2980,6 @@ int
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 void
 _Py_Specialize_ForIter(_PyStackRef iter, _Py_CODEUNIT *instr, int oparg)
@@ -2671,6 +3001,18 @@ _Py_Specialize_ForIter(_PyStackRef iter, _Py_CODEUNIT *instr, int oparg)
         instr->op.code = FOR_ITER_RANGE;
         goto success;
     }
+    else if (tp == &PyDictIterItem_Type) {
+        instr->op.code = FOR_ITER_DICT_ITEMS;
+        goto success;
+    }
+    else if (tp == &PyEnum_Type) {
+        instr->op.code = FOR_ITER_ENUMERATE;
+        goto success;
+    }
+    else if (tp == &PyZip_Type && _PyZip_IsPair(iter_o)) {
+        instr->op.code = FOR_ITER_ZIP;
+        goto success;
+    }
     else if (tp == &PyGen_Type && oparg <= SHRT_MAX) {
         assert(instr[oparg + INLINE_CACHE_ENTRIES_FOR_ITER + 1].op.code == END_FOR  ||
             instr[oparg + INLINE_CACHE_ENTRIES_FOR_ITER + 1].op.code == INSTRUMENTED_END_FOR
@@ -2718,7 +3060,6 @@ _Py_Specialize_Send(_PyStackRef receiver_st, _Py_CODEUNIT *instr)
     unspecialize(instr);
 }
 
-#ifdef Py_STATS
 static int
 to_bool_fail_kind(PyObject *value)
 {
@@ -2745,7 +3086,6 @@ to_bool_fail_kind(PyObject *value)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif  // Py_STATS
 
 static int
 check_type_always_true(PyTypeObject *ty)
@@ -2820,7 +3160,6 @@ _Py_Specialize_ToBool(_PyStackRef value_o, _Py_CODEUNIT *instr)
     specialize(instr, specialized_op);
 }
 
-#ifdef Py_STATS
 static int
 containsop_fail_kind(PyObject *value) {
     if (PyUnicode_CheckExact(value)) {
@@ -2829,15 +3168,11 @@ containsop_fail_kind(PyObject *value) {
     if (PyList_CheckExact(value)) {
         return SPEC_FAIL_CONTAINS_OP_LIST;
     }
-    if (PyTuple_CheckExact(value)) {
-        return SPEC_FAIL_CONTAINS_OP_TUPLE;
-    }
     if (PyType_Check(value)) {
         return SPEC_FAIL_CONTAINS_OP_USER_CLASS;
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 void
 _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
@@ -2854,6 +3189,10 @@ _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
         specialize(instr, CONTAINS_OP_SET);
         return;
     }
+    if (PyTuple_CheckExact(value)) {
+        specialize(instr, CONTAINS_OP_TUPLE);
+        return;
+    }
 
     SPECIALIZATION_FAIL(CONTAINS_OP, containsop_fail_kind(value));
     unspecialize(instr);
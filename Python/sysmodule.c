@@ -2156,6 +2156,21 @@ sys__clear_internal_caches_impl(PyObject *module)
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+sys._get_executor_stats
+
+Return the execution counters of the tier 2 executors.
+
+Returns a list with a dict per live executor.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_executor_stats_impl(PyObject *module)
+/*[clinic end generated code: output=9347aa605906d68d input=5789e19373ed40ee]*/
+{
+    return _PyExecutor_GetStats(_PyInterpreterState_GET());
+}
+
 /* Note that, for now, we do not have a per-interpreter equivalent
   for sys.is_finalizing(). */
 
@@ -2564,6 +2579,7 @@ static PyMethodDef sys_methods[] = {
     {"breakpointhook", _PyCFunction_CAST(sys_breakpointhook),
      METH_FASTCALL | METH_KEYWORDS, breakpointhook_doc},
     SYS__CLEAR_INTERNAL_CACHES_METHODDEF
+    SYS__GET_EXECUTOR_STATS_METHODDEF
     SYS__CLEAR_TYPE_CACHE_METHODDEF
     SYS__CURRENT_FRAMES_METHODDEF
     SYS__CURRENT_EXCEPTIONS_METHODDEF
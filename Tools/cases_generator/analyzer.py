@@ -228,6 +228,8 @@ class Instruction:
     is_target: bool = False
     family: Optional["Family"] = None
     opcode: int = -1
+    # For superinstructions, the instruction executed from the next code unit
+    second: Optional["Instruction"] = None
 
     @property
     def properties(self) -> Properties:
@@ -283,12 +285,22 @@ def dump(self, indent: str) -> None:
         print(indent, self.name, "= ", ", ".join([m.name for m in self.members]))
 
 
+@dataclass
+class Label:
+    name: str
+    body: list[lexer.Token]
+
+    def dump(self, indent: str) -> None:
+        print(indent, self.name)
+
+
 @dataclass
 class Analysis:
     instructions: dict[str, Instruction]
     uops: dict[str, Uop]
     families: dict[str, Family]
     pseudos: dict[str, PseudoInstruction]
+    labels: dict[str, Label]
     opmap: dict[str, int]
     have_arg: int
     min_instrumented: int
@@ -593,13 +605,16 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyList_FromStackRefSteal",
     "_PyList_ITEMS",
     "_PyLong_Add",
+    "_PyLong_Add_ConsumeInputs",
     "_PyLong_CompactValue",
     "_PyLong_DigitCount",
     "_PyLong_IsCompact",
     "_PyLong_IsNonNegativeCompact",
     "_PyLong_IsZero",
     "_PyLong_Multiply",
+    "_PyLong_Multiply_ConsumeInputs",
     "_PyLong_Subtract",
+    "_PyLong_Subtract_ConsumeInputs",
     "_PyManagedDictPointer_IsValues",
     "_PyObject_GC_IS_TRACKED",
     "_PyObject_GC_MAY_BE_TRACKED",
@@ -615,6 +630,7 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyType_NewManagedObject",
     "_PyUnicode_Equal",
     "_PyUnicode_JoinArray",
+    "_PyZip_IsPair",
     "_Py_CHECK_EMSCRIPTEN_SIGNALS_PERIODICALLY",
     "_Py_DECREF_NO_DEALLOC",
     "_Py_DECREF_SPECIALIZED",
@@ -989,6 +1005,111 @@ def add_family(
     families[family.name] = family
 
 
+def super_instruction_error(
+    first: Instruction,
+    second: Instruction,
+    families: dict[str, Family],
+    uops: dict[str, Uop],
+) -> str | None:
+    """Returns the reason why `second` cannot be executed as part of
+    a superinstruction specializing `first`, or None if it can.
+
+    The superinstruction replaces `first` at quickening time. `second`
+    remains in the following code unit, so both must be unspecialized
+    and `second` must not need to find its own code unit or caches."""
+    for inst in (first, second):
+        if inst.family is not None:
+            return f"{inst.name} is a specialized instruction"
+        family = families.get(inst.name)
+        if family is not None and any(m.second is None for m in family.members):
+            return f"{inst.name} is specializable"
+        if inst.name.startswith("INSTRUMENTED"):
+            return f"{inst.name} is an instrumented instruction"
+    if first.is_super():
+        return f"{first.name} is already a superinstruction"
+    if first.size > 1:
+        return f"{first.name} has cache entries"
+    if first.properties.jumps or first.properties.always_exits or leaves_frame(first):
+        return f"{first.name} does not fall through"
+    if first.properties.eval_breaker:
+        return f"{first.name} checks the eval breaker"
+    if first.name in inspected_opcodes(uops):
+        return f"{first.name} is looked for by other instructions"
+    if uses_caches(second) or second.properties.needs_this:
+        return f"{second.name} needs its own code unit"
+    return None
+
+
+LEAVES_FRAME = {
+    "LOAD_IP",
+    "DISPATCH_INLINED",
+    "DISPATCH_GOTO",
+    "GOTO_TIER_TWO",
+    "GO_TO_INSTRUCTION",
+    "Py_FatalError",
+}
+
+
+def leaves_frame(inst: Instruction) -> bool:
+    "Does the instruction continue other than at the next instruction?"
+    for part in inst.parts:
+        if isinstance(part, Uop):
+            for tkn in part.body:
+                if tkn.kind == "IDENTIFIER" and tkn.text in LEAVES_FRAME:
+                    return True
+    return False
+
+
+def inspected_opcodes(uops: dict[str, Uop]) -> set[str]:
+    "Names compared with `op.code`, for example to skip over that instruction"
+    names: set[str] = set()
+    for uop in uops.values():
+        for i, tkn in enumerate(uop.body[:-2]):
+            if tkn.text == "code" and uop.body[i - 1].text == ".":
+                if uop.body[i + 1].text in ("==", "!="):
+                    names.add(uop.body[i + 2].text)
+    return names
+
+
+def uses_caches(inst: Instruction) -> bool:
+    for part in inst.parts:
+        if isinstance(part, Uop):
+            for cache in part.caches:
+                if cache.name != "unused":
+                    return True
+    return False
+
+
+def add_super(
+    sup: parser.Super,
+    instructions: dict[str, Instruction],
+    families: dict[str, Family],
+    uops: dict[str, Uop],
+) -> None:
+    if sup.name in instructions:
+        raise analysis_error(f"Duplicate instruction {sup.name}", sup.first_token)
+    for name in (sup.first, sup.second):
+        if name not in instructions:
+            raise analysis_error(f"No instruction named {name}", sup.first_token)
+    first = instructions[sup.first]
+    second = instructions[sup.second]
+    reason = super_instruction_error(first, second, families, uops)
+    if reason is not None:
+        raise analysis_error(
+            f"Cannot combine {first.name} and {second.name}: {reason}",
+            sup.first_token,
+        )
+    # The superinstruction is a specialization of the first instruction,
+    # so it shares its format and metadata.
+    inst = Instruction(sup.first_token, sup.name, list(first.parts), None)
+    inst.second = second
+    instructions[sup.name] = inst
+    if first.name not in families:
+        families[first.name] = Family(first.name, "0", [])
+    inst.family = families[first.name]
+    inst.family.members.append(inst)
+
+
 def add_pseudo(
     pseudo: parser.Pseudo,
     instructions: dict[str, Instruction],
@@ -1019,8 +1140,9 @@ def assign_opcodes(
     # This helps catch cases where we attempt to execute a cache.
     instmap["RESERVED"] = 17
 
-    # 149 is RESUME - it is hard coded as such in Tools/build/deepfreeze.py
-    instmap["RESUME"] = 149
+    # 128 is RESUME - it is hard coded as such in Tools/build/deepfreeze.py
+    # Everything above it, up to the instrumented opcodes, is specialized.
+    instmap["RESUME"] = 128
 
     # This is an historical oddity.
     instmap["BINARY_OP_INPLACE_ADD_UNICODE"] = 3
@@ -1050,7 +1172,7 @@ def assign_opcodes(
 
     # Specialized ops appear in their own section
     # Instrumented opcodes are at the end of the valid range
-    min_internal = 150
+    min_internal = instmap["RESUME"] + 1
     min_instrumented = 254 - (len(instrumented) - 1)
     assert min_internal + len(specialized) < min_instrumented
 
@@ -1069,6 +1191,7 @@ def add_instruction(name: str) -> None:
         add_instruction(name)
     for name in sorted(has_arg):
         add_instruction(name)
+    assert next_opcode <= instmap["RESUME"]
     # For compatibility
     next_opcode = min_internal
     for name in sorted(specialized):
@@ -1121,6 +1244,7 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
     uops: dict[str, Uop] = {}
     families: dict[str, Family] = {}
     pseudos: dict[str, PseudoInstruction] = {}
+    labels: dict[str, Label] = {}
     for node in forest:
         match node:
             case parser.InstDef(name):
@@ -1131,10 +1255,18 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
                     add_op(node, uops)
             case parser.Macro():
                 pass
+            case parser.Super():
+                pass
             case parser.Family():
                 pass
             case parser.Pseudo():
                 pass
+            case parser.LabelDef(name):
+                if name in labels:
+                    raise analysis_error(
+                        f"Duplicate label {name}", node.first_token
+                    )
+                labels[name] = Label(name, node.block.tokens)
             case _:
                 assert False
     for node in forest:
@@ -1148,6 +1280,9 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
                 add_pseudo(node, instructions, pseudos)
             case _:
                 pass
+    for node in forest:
+        if isinstance(node, parser.Super):
+            add_super(node, instructions, families, uops)
     for uop in uops.values():
         tkn_iter = iter(uop.body)
         for tkn in tkn_iter:
@@ -1171,7 +1306,14 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
         families["BINARY_OP"].members.append(inst)
     opmap, first_arg, min_instrumented = assign_opcodes(instructions, families, pseudos)
     return Analysis(
-        instructions, uops, families, pseudos, opmap, first_arg, min_instrumented
+        instructions,
+        uops,
+        families,
+        pseudos,
+        labels,
+        opmap,
+        first_arg,
+        min_instrumented,
     )
 
 
@@ -1192,6 +1334,9 @@ def dump_analysis(analysis: Analysis) -> None:
     print("Pseudos:")
     for p in analysis.pseudos.values():
         p.dump("    ")
+    print("Labels:")
+    for l in analysis.labels.values():
+        l.dump("    ")
 
 
 if __name__ == "__main__":
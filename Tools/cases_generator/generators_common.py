@@ -3,6 +3,7 @@
 
 from analyzer import (
     Instruction,
+    Label,
     Uop,
     Properties,
     StackItem,
@@ -192,19 +193,19 @@ def error_if(
         except ValueError:
             offset = -1
         if offset > 0:
-            self.out.emit(f"goto pop_{offset}_")
+            self.out.emit(f"JUMP_TO_LABEL(pop_{offset}_")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
         elif offset == 0:
-            self.out.emit("goto ")
+            self.out.emit("JUMP_TO_LABEL(")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
         else:
             self.out.emit("{\n")
             storage.copy().flush(self.out)
-            self.out.emit("goto ")
+            self.out.emit("JUMP_TO_LABEL(")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
             self.out.emit("}\n")
         return not unconditional
 
@@ -219,9 +220,17 @@ def error_no_pop(
         next(tkn_iter)  # LPAREN
         next(tkn_iter)  # RPAREN
         next(tkn_iter)  # Semi colon
-        self.out.emit_at("goto error;", tkn)
+        self.out.emit_at("JUMP_TO_LABEL(error);", tkn)
         return False
 
+    def goto_label(self, goto: Token, label: Token) -> None:
+        # Jumps to labels go through JUMP_TO_LABEL, so that the interpreter
+        # can implement them as either a goto or a tail call.
+        self.out.emit_at("JUMP_TO_LABEL", goto)
+        self.out.emit("(")
+        self.out.emit(label)
+        self.out.emit(")")
+
     def decref_inputs(
         self,
         tkn: Token,
@@ -504,8 +513,9 @@ def _emit_block(
                         return reachable, tkn, storage
                     self.out.emit(tkn)
                 elif tkn.kind == "GOTO":
-                    reachable = False;
-                    self.out.emit(tkn)
+                    label_tkn = next(tkn_iter)
+                    self.goto_label(tkn, label_tkn)
+                    reachable = False
                 elif tkn.kind == "IDENTIFIER":
                     if tkn.text in self._replacers:
                         if not self._replacers[tkn.text](tkn, tkn_iter, uop, storage, inst):
@@ -551,6 +561,15 @@ def emit_tokens(
             raise analysis_error(ex.args[0], rbrace)
         return storage
 
+    def emit_label(self, label: Label) -> None:
+        tkn_iter = TokenIterator(label.body)
+        self.out.start_line()
+        for tkn in tkn_iter:
+            if tkn.kind == "GOTO":
+                self.goto_label(tkn, next(tkn_iter))
+            else:
+                self.out.emit(tkn)
+
     def emit(self, txt: str | Token) -> None:
         self.out.emit(txt)
 
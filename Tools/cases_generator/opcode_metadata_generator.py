@@ -254,6 +254,31 @@ def generate_deopt_table(analysis: Analysis, out: CWriter) -> None:
     out.emit("#endif // NEED_OPCODE_METADATA\n\n")
 
 
+def generate_super_instruction_function(analysis: Analysis, out: CWriter) -> None:
+    supers: dict[str, list[Instruction]] = {}
+    for inst in analysis.instructions.values():
+        if inst.second is not None:
+            assert inst.family is not None
+            supers.setdefault(inst.family.name, []).append(inst)
+    out.emit("extern int _PyOpcode_super_instruction(int opcode, int next_opcode);\n")
+    out.emit("#ifdef NEED_OPCODE_METADATA\n")
+    out.emit("int _PyOpcode_super_instruction(int opcode, int next_opcode)  {\n")
+    out.emit("switch(opcode) {\n")
+    for first, members in sorted(supers.items()):
+        out.emit(f"case {first}:\n")
+        out.emit("    switch(next_opcode) {\n")
+        for inst in sorted(members, key=lambda i: i.name):
+            assert inst.second is not None
+            out.emit(f"    case {inst.second.name}:\n")
+            out.emit(f"        return {inst.name};\n")
+        out.emit("    }\n")
+        out.emit("    break;\n")
+    out.emit("}\n")
+    out.emit("return opcode;\n")
+    out.emit("}\n\n")
+    out.emit("#endif\n\n")
+
+
 def generate_cache_table(analysis: Analysis, out: CWriter) -> None:
     out.emit("extern const uint8_t _PyOpcode_Caches[256];\n")
     out.emit("#ifdef NEED_OPCODE_METADATA\n")
@@ -461,6 +486,7 @@ def generate_opcode_metadata(
         generate_name_table(analysis, out)
         generate_cache_table(analysis, out)
         generate_deopt_table(analysis, out)
+        generate_super_instruction_function(analysis, out)
         generate_extra_cases(analysis, out)
         generate_pseudo_targets(analysis, out)
 
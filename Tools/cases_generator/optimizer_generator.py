@@ -112,6 +112,10 @@ def emit_save(self, storage: Storage) -> None:
     def emit_reload(self, storage: Storage) -> None:
         pass
 
+    def goto_label(self, goto: Token, label: Token) -> None:
+        self.out.emit(goto)
+        self.out.emit(label)
+
 
 def write_uop(
     override: Uop | None,
@@ -1,8 +1,10 @@
 from parsing import (  # noqa: F401
     InstDef,
     Macro,
+    Super,
     Pseudo,
     Family,
+    LabelDef,
     Parser,
     Context,
     CacheEffect,
@@ -134,6 +134,13 @@ class Macro(Node):
     uops: list[UOp]
 
 
+@dataclass
+class Super(Node):
+    name: str
+    first: str
+    second: str
+
+
 @dataclass
 class Family(Node):
     name: str
@@ -151,7 +158,13 @@ class Pseudo(Node):
     as_sequence: bool
 
 
-AstNode = InstDef | Macro | Pseudo | Family
+@dataclass
+class LabelDef(Node):
+    name: str
+    block: Block
+
+
+AstNode = InstDef | Macro | Super | Pseudo | Family | LabelDef
 
 
 class Parser(PLexer):
@@ -159,14 +172,30 @@ class Parser(PLexer):
     def definition(self) -> AstNode | None:
         if macro := self.macro_def():
             return macro
+        if sup := self.super_def():
+            return sup
         if family := self.family_def():
             return family
         if pseudo := self.pseudo_def():
             return pseudo
+        if label := self.label_def():
+            return label
         if inst := self.inst_def():
             return inst
         return None
 
+    @contextual
+    def label_def(self) -> LabelDef | None:
+        # label(NAME) { ... }
+        if (tkn := self.expect(lx.IDENTIFIER)) and tkn.text == "label":
+            if self.expect(lx.LPAREN):
+                if tkn := self.expect(lx.IDENTIFIER):
+                    if self.expect(lx.RPAREN):
+                        if block := self.block():
+                            return LabelDef(tkn.text, block)
+                        raise self.make_syntax_error("Expected block")
+        return None
+
     @contextual
     def inst_def(self) -> InstDef | None:
         if hdr := self.inst_header():
@@ -371,6 +400,25 @@ def uop(self) -> UOp | None:
                 return OpName(tkn.text)
         return None
 
+    @contextual
+    def super_def(self) -> Super | None:
+        # super(NAME) = FIRST + SECOND;
+        if (tkn := self.expect(lx.IDENTIFIER)) and tkn.text == "super":
+            if self.expect(lx.LPAREN):
+                if name := self.expect(lx.IDENTIFIER):
+                    if self.expect(lx.RPAREN):
+                        if self.expect(lx.EQUALS):
+                            if first := self.expect(lx.IDENTIFIER):
+                                if not self.expect(lx.PLUS):
+                                    raise self.make_syntax_error("Expected +")
+                                if not (second := self.expect(lx.IDENTIFIER)):
+                                    raise self.make_syntax_error(
+                                        "Expected instruction name"
+                                    )
+                                self.require(lx.SEMI)
+                                return Super(name.text, first.text, second.text)
+        return None
+
     @contextual
     def family_def(self) -> Family | None:
         if (tkn := self.expect(lx.IDENTIFIER)) and tkn.text == "family":
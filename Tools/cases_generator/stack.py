@@ -263,7 +263,10 @@ def pop(self, var: StackItem, extract_bits: bool = True) -> tuple[str, Local]:
                 if var.is_array():
                     defn = f"{var.name} = &stack_pointer[{self.top_offset.to_c()}];\n"
                 else:
-                    defn = f"{var.name} = stack_pointer[{self.top_offset.to_c()}];\n"
+                    defn = f"{var.name} = stack_pointer[{self.top_offset.to_c()}];"
+                    if var.condition and var.condition != "1":
+                        defn = f"if ({var.condition}) {{ {defn} }}"
+                    defn += "\n"
                     popped.in_memory = True
             return defn, Local.redefinition(var, popped)
 
@@ -0,0 +1,303 @@
+"""Generate the stack-caching variants of the tier 2 micro-ops.
+Reads the instruction definitions from bytecodes.c.
+Writes one case per micro-op and cache depth to executor_cases_cached.c.h.
+
+In a variant with input cache depth N, the top N stack items live in the
+locals _tos0 (deepest) to _tos{N-1} (top of stack) instead of in the
+frame. Inputs are read from those locals, and as many outputs as fit are
+left in them. The variant's name records the cache depth on entry and on
+exit: _LOAD_FAST_r12 expects one cached item and leaves two.
+"""
+
+import argparse
+
+from analyzer import (
+    Analysis,
+    Instruction,
+    Uop,
+    analyze_files,
+    analysis_error,
+)
+from generators_common import (
+    DEFAULT_INPUT,
+    ROOT,
+    write_header,
+    TokenIterator,
+    emit_to,
+    always_true,
+)
+from cwriter import CWriter
+from typing import TextIO
+from lexer import Token
+from stack import Stack, StackError, Storage
+from tier2_generator import Tier2Emitter, declare_variables
+
+DEFAULT_OUTPUT = ROOT / "Python/executor_cases_cached.c.h"
+
+# Three items fit in the argument registers left over by the stencil calling
+# convention on all the JIT's targets.
+DEFAULT_MAX_DEPTH = 3
+
+# Macros and names that touch the in-memory stack directly.
+UNCACHEABLE_NAMES = {
+    "stack_pointer",
+    "SAVE_STACK",
+    "RELOAD_STACK",
+    "POP_DEAD_INPUTS",
+    "_PyFrame_SetStackPointer",
+    "_PyFrame_GetStackPointer",
+}
+
+
+def why_not_cacheable(uop: Uop) -> str | None:
+    if uop.properties.escapes:
+        return "escapes"
+    if uop.properties.always_exits:
+        return "always exits"
+    if uop.properties.stores_sp:
+        return "stores the stack pointer"
+    for var in uop.stack.inputs + uop.stack.outputs:
+        if var.is_array() or var.condition:
+            return "has a variable stack effect"
+        if var.type:
+            return "has typed stack items"
+    for tkn in uop.body:
+        if tkn.kind == "IDENTIFIER" and tkn.text in UNCACHEABLE_NAMES:
+            return f"uses {tkn.text}"
+    inputs = uop.stack.inputs
+    for i, var in enumerate(uop.stack.outputs):
+        if var.name == "unused" and (i >= len(inputs) or inputs[i].name != "unused"):
+            return "leaves an unused output"
+    return None
+
+
+def spill(depth: int, out: CWriter) -> None:
+    """Write all cached items to the frame, leaving an empty cache."""
+    for i in range(depth):
+        out.emit(f"stack_pointer[{i}] = _tos{i};\n")
+    if depth:
+        out.emit(f"stack_pointer += {depth};\n")
+        out.emit("assert(WITHIN_STACK_BOUNDS());\n")
+
+
+class CachedEmitter(Tier2Emitter):
+
+    def __init__(self, out: CWriter, depth: int):
+        super().__init__(out)
+        self.depth = depth
+
+    # Like the plain tier 2 code, exits and errors leave the stack pointer
+    # where it was when the micro-op started, and the code they jump to
+    # expects the whole stack to be in memory. The error stub pops the
+    # inputs without looking at them, so spilling the whole cache is right
+    # whether or not they have been consumed.
+
+    def _exit_if(self, tkn: Token, tkn_iter: TokenIterator) -> bool:
+        self.out.emit_at("if ", tkn)
+        lparen = next(tkn_iter)
+        self.emit(lparen)
+        first_tkn = tkn_iter.peek()
+        emit_to(self.out, tkn_iter, "RPAREN")
+        next(tkn_iter)  # Semi colon
+        self.emit(") {\n")
+        self.emit("UOP_STAT_INC(uopcode, miss);\n")
+        spill(self.depth, self.out)
+        self.emit("JUMP_TO_JUMP_TARGET();\n")
+        self.emit("}\n")
+        return not always_true(first_tkn)
+
+    def deopt_if(
+        self,
+        tkn: Token,
+        tkn_iter: TokenIterator,
+        uop: Uop,
+        storage: Storage,
+        inst: Instruction | None,
+    ) -> bool:
+        return self._exit_if(tkn, tkn_iter)
+
+    exit_if = deopt_if
+
+    def error_if(
+        self,
+        tkn: Token,
+        tkn_iter: TokenIterator,
+        uop: Uop,
+        storage: Storage,
+        inst: Instruction | None,
+    ) -> bool:
+        self.out.emit_at("if ", tkn)
+        lparen = next(tkn_iter)
+        self.emit(lparen)
+        first_tkn = next(tkn_iter)
+        self.out.emit(first_tkn)
+        emit_to(self.out, tkn_iter, "COMMA")
+        next(tkn_iter)  # Label
+        next(tkn_iter)  # RPAREN
+        next(tkn_iter)  # Semi colon
+        self.emit(") {\n")
+        spill(self.depth, self.out)
+        self.emit("JUMP_TO_ERROR();\n")
+        self.emit("}\n")
+        return not always_true(first_tkn)
+
+    def error_no_pop(
+        self,
+        tkn: Token,
+        tkn_iter: TokenIterator,
+        uop: Uop,
+        storage: Storage,
+        inst: Instruction | None,
+    ) -> bool:
+        next(tkn_iter)  # LPAREN
+        next(tkn_iter)  # RPAREN
+        next(tkn_iter)  # Semi colon
+        spill(self.depth, self.out)
+        self.out.emit_at("JUMP_TO_ERROR();", tkn)
+        return False
+
+
+def write_variant(uop: Uop, depth: int, max_depth: int, out: CWriter) -> None:
+    inputs = uop.stack.inputs
+    outputs = uop.stack.outputs
+    cached = min(depth, len(inputs))
+    below = depth - cached
+    in_memory = len(inputs) - cached
+
+    # Where each input is before the micro-op runs.
+    def location(pos: int) -> str:
+        if pos < in_memory:
+            return f"stack_pointer[{pos - in_memory}]"
+        return f"_tos{below + pos - in_memory}"
+
+    final = [f"_tos{i}" for i in range(below)]
+    for pos, var in enumerate(outputs):
+        if var.name == "unused" or (pos < len(inputs) and var.peek):
+            final.append(location(pos))
+        else:
+            final.append(var.name)
+    out_depth = min(max_depth, len(final))
+    spilled = len(final) - out_depth
+
+    out.emit(f"case {uop.name}_r{depth}{out_depth}: {{\n")
+    declare_variables(uop, out)
+    emitter = CachedEmitter(out, depth)
+    try:
+        out.start_line()
+        if uop.properties.oparg:
+            out.emit("oparg = CURRENT_OPARG();\n")
+        elif uop.properties.const_oparg >= 0:
+            out.emit(f"oparg = {uop.properties.const_oparg};\n")
+            out.emit(f"assert(oparg == CURRENT_OPARG());\n")
+        for pos in reversed(range(len(inputs))):
+            var = inputs[pos]
+            if var.used and var.name != "unused":
+                out.emit(f"{var.name} = {location(pos)};\n")
+        # The code generated for the inputs is replaced by the loads above,
+        # but the storage still tracks their liveness through the body.
+        _, storage = Storage.for_uop(Stack(), uop)
+        for idx, cache in enumerate(uop.caches):
+            if cache.name != "unused":
+                if cache.size == 4:
+                    type = cast = "PyObject *"
+                else:
+                    type = f"uint{cache.size*16}_t "
+                    cast = f"uint{cache.size*16}_t"
+                out.emit(f"{type}{cache.name} = ({cast})CURRENT_OPERAND{idx}();\n")
+        emitter.emit_tokens(uop, storage, None)
+    except StackError as ex:
+        raise analysis_error(ex.args[0], uop.body[0]) from None
+    out.start_line()
+    for i in range(spilled):
+        dest = f"stack_pointer[{i - in_memory}]"
+        if final[i] != dest:
+            out.emit(f"{dest} = {final[i]};\n")
+    # Cached items all move the same way: down when items were spilled to
+    # the frame, up when inputs were read from it. Move them in an order
+    # that never overwrites an item that still has to be moved.
+    order = list(range(out_depth))
+    if spilled < in_memory:
+        order.reverse()
+    for i in order:
+        if final[spilled + i] != f"_tos{i}":
+            out.emit(f"_tos{i} = {final[spilled + i]};\n")
+    if spilled != in_memory:
+        out.emit(f"stack_pointer += {spilled - in_memory};\n")
+        out.emit("assert(WITHIN_STACK_BOUNDS());\n")
+    out.emit("break;\n")
+    out.start_line()
+    out.emit("}\n\n")
+
+
+def generate_stack_cache(
+    filenames: list[str], analysis: Analysis, outfile: TextIO, lines: bool,
+    max_depth: int = DEFAULT_MAX_DEPTH
+) -> None:
+    write_header(__file__, filenames, outfile)
+    outfile.write(
+        """
+#ifdef TIER_ONE
+    #error "This file is for Tier 2 only"
+#endif
+#define TIER_TWO 2
+"""
+    )
+    out = CWriter(outfile, 2, lines)
+    out.emit("\n")
+    for depth in range(1, max_depth + 1):
+        out.emit(f"case _SPILL_r{depth}0: {{\n")
+        spill(depth, out)
+        out.emit("break;\n")
+        out.emit("}\n\n")
+    for name, uop in analysis.uops.items():
+        if uop.properties.tier == 1:
+            continue
+        if uop.properties.oparg_and_1 or uop.is_super() or not uop.is_viable():
+            continue
+        why_not = why_not_cacheable(uop)
+        if why_not is not None:
+            out.emit(f"/* {uop.name} needs an empty cache because it {why_not} */\n\n")
+            continue
+        for depth in range(max_depth + 1):
+            write_variant(uop, depth, max_depth, out)
+    outfile.write("#undef TIER_TWO\n")
+
+
+def generate_stack_cache_from_files(
+    filenames: list[str], outfilename: str, lines: bool,
+    max_depth: int = DEFAULT_MAX_DEPTH
+) -> None:
+    data = analyze_files(filenames)
+    with open(outfilename, "w") as outfile:
+        generate_stack_cache(filenames, data, outfile, lines, max_depth)
+
+
+arg_parser = argparse.ArgumentParser(
+    description="Generate the stack-caching variants of the tier 2 micro-ops.",
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+)
+
+arg_parser.add_argument(
+    "-o", "--output", type=str, help="Generated code", default=DEFAULT_OUTPUT
+)
+
+arg_parser.add_argument(
+    "-l", "--emit-line-directives", help="Emit #line directives", action="store_true"
+)
+
+arg_parser.add_argument(
+    "-d", "--max-depth", type=int, help="Number of cached stack items",
+    default=DEFAULT_MAX_DEPTH
+)
+
+arg_parser.add_argument(
+    "input", nargs=argparse.REMAINDER, help="Instruction definition file(s)"
+)
+
+if __name__ == "__main__":
+    args = arg_parser.parse_args()
+    if len(args.input) == 0:
+        args.input.append(DEFAULT_INPUT)
+    generate_stack_cache_from_files(
+        args.input, args.output, args.emit_line_directives, args.max_depth
+    )
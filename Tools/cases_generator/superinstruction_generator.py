@@ -0,0 +1,166 @@
+"""Generate superinstruction definitions from a pair-frequency profile.
+Reads the instruction definitions from bytecodes.c and the execution
+statistics of a workload run with a --enable-pystats build.
+Writes `super(...)` definitions, to be added to bytecodes.c, to stdout
+by default.
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import sys
+from pathlib import Path
+from typing import TextIO
+
+from analyzer import (
+    Analysis,
+    Instruction,
+    analyze_files,
+    super_instruction_error,
+)
+from generators_common import (
+    DEFAULT_INPUT,
+)
+
+if os.name == "nt":
+    DEFAULT_STATS = "c:\\temp\\py_stats\\"
+else:
+    DEFAULT_STATS = "/tmp/py_stats/"
+
+PAIR_COUNT = re.compile(r"opcode\[(\w+)\]\.pair_count\[(\w+)\]")
+
+
+def load_pair_counts(path: Path) -> collections.Counter[tuple[str, str]]:
+    """Load the pair counts from either a directory of raw stats files,
+    or the JSON output of Tools/scripts/summarize_stats.py."""
+    items: list[tuple[str, str | int]] = []
+    if path.is_file():
+        with open(path) as fd:
+            items.extend(json.load(fd).items())
+    elif path.is_dir():
+        for filename in path.iterdir():
+            with open(filename) as fd:
+                for line in fd:
+                    key, _, value = line.partition(":")
+                    items.append((key.strip(), value))
+    else:
+        raise ValueError(f"{path} is not a file or directory path")
+    counts = collections.Counter[tuple[str, str]]()
+    for key, value in items:
+        if match := PAIR_COUNT.fullmatch(key):
+            counts[match[1], match[2]] += int(value)
+    return counts
+
+
+def free_opcodes(analysis: Analysis) -> int:
+    "The number of superinstructions that can still be added"
+    specialized = sum(len(f.members) for f in analysis.families.values())
+    min_internal = analysis.opmap["RESUME"] + 1
+    return analysis.min_instrumented - min_internal - specialized - 1
+
+
+def unspecialized(analysis: Analysis, name: str) -> str:
+    "Superinstructions are counted as their first instruction"
+    inst = analysis.instructions.get(name)
+    if inst is not None and inst.second is not None:
+        assert inst.family is not None
+        return inst.family.name
+    return name
+
+
+def select_pairs(
+    analysis: Analysis,
+    counts: collections.Counter[tuple[str, str]],
+    limit: int,
+    verbose: bool,
+) -> list[tuple[Instruction, Instruction, int]]:
+    existing = {
+        (inst.family.name, inst.second.name)
+        for inst in analysis.instructions.values()
+        if inst.second is not None and inst.family is not None
+    }
+    combined = collections.Counter[tuple[str, str]]()
+    for (first, second), count in counts.items():
+        combined[unspecialized(analysis, first), second] += count
+    selected: list[tuple[Instruction, Instruction, int]] = []
+    for (first, second), count in combined.most_common():
+        if len(selected) >= limit:
+            break
+        if (first, second) in existing:
+            continue
+        if first not in analysis.instructions or second not in analysis.instructions:
+            if verbose:
+                print(f"Skipping {first} + {second}: unknown instruction", file=sys.stderr)
+            continue
+        inst1 = analysis.instructions[first]
+        inst2 = analysis.instructions[second]
+        reason = super_instruction_error(
+            inst1, inst2, analysis.families, analysis.uops
+        )
+        if reason is not None:
+            if verbose:
+                print(f"Skipping {first} + {second} ({count}): {reason}", file=sys.stderr)
+            continue
+        selected.append((inst1, inst2, count))
+    return selected
+
+
+def generate_superinstructions(
+    analysis: Analysis,
+    counts: collections.Counter[tuple[str, str]],
+    limit: int,
+    verbose: bool,
+    outfile: TextIO,
+) -> None:
+    available = free_opcodes(analysis)
+    if limit > available:
+        print(f"Only {available} opcodes are available", file=sys.stderr)
+        limit = available
+    total = sum(counts.values()) or 1
+    for first, second, count in select_pairs(analysis, counts, limit, verbose):
+        outfile.write(f"// {count} pairs ({100 * count / total:.2f}%)\n")
+        outfile.write(f"super({first.name}__{second.name}) = {first.name} + {second.name};\n")
+
+
+arg_parser = argparse.ArgumentParser(
+    description="Generate superinstructions for the most frequent pairs of instructions.",
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+)
+
+arg_parser.add_argument(
+    "-o", "--output", type=str, help="Generated definitions", default=None
+)
+
+arg_parser.add_argument(
+    "-s",
+    "--stats",
+    type=str,
+    help="Raw stats directory or JSON output of summarize_stats.py",
+    default=DEFAULT_STATS,
+)
+
+arg_parser.add_argument(
+    "-n", "--limit", type=int, help="Maximum number of superinstructions", default=4
+)
+
+arg_parser.add_argument(
+    "-v", "--verbose", help="Report pairs that cannot be combined", action="store_true"
+)
+
+arg_parser.add_argument(
+    "input", nargs=argparse.REMAINDER, help="Instruction definition file(s)"
+)
+
+if __name__ == "__main__":
+    args = arg_parser.parse_args()
+    if len(args.input) == 0:
+        args.input.append(DEFAULT_INPUT)
+    data = analyze_files(args.input)
+    counts = load_pair_counts(Path(args.stats))
+    if args.output is None:
+        generate_superinstructions(data, counts, args.limit, args.verbose, sys.stdout)
+    else:
+        with open(args.output, "w") as outfile:
+            generate_superinstructions(data, counts, args.limit, args.verbose, outfile)
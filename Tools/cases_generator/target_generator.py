@@ -1,6 +1,6 @@
-"""Generate targets for computed goto dispatch
+"""Generate targets for computed goto and tail-call dispatch
 Reads the instruction definitions from bytecodes.c.
-Writes the table to opcode_targets.h by default.
+Writes the tables to opcode_targets.h by default.
 """
 
 import argparse
@@ -25,10 +25,57 @@ def write_opcode_targets(analysis: Analysis, out: CWriter) -> None:
     for name, op in analysis.opmap.items():
         if op < 256:
             targets[op] = f"&&TARGET_{name},\n"
+    out.emit("#if !Py_TAIL_CALL_INTERP\n")
     out.emit("static void *opcode_targets[256] = {\n")
     for target in targets:
         out.emit(target)
     out.emit("};\n")
+    out.emit("#else /* Py_TAIL_CALL_INTERP */\n")
+
+
+def function_proto(name: str) -> str:
+    return f"Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_{name}(TAIL_CALL_PARAMS)"
+
+
+def write_tailcall_dispatch_table(analysis: Analysis, out: CWriter) -> None:
+    """Write the handler prototypes and the dispatch table of the tail-calling
+    interpreter, where every instruction and label is a function."""
+    out.emit("static py_tail_call_funcptr INSTRUCTION_TABLE[256];\n")
+    out.emit("\n")
+
+    # Emit function prototypes for labels.
+    for name in analysis.labels:
+        out.emit(f"{function_proto(name)};\n")
+    out.emit("\n")
+
+    # Emit function prototypes for opcode handlers.
+    for name in sorted(analysis.instructions.keys()):
+        out.emit(f"{function_proto(name)};\n")
+    out.emit("\n")
+
+    # Emit unknown opcode handler.
+    out.emit(function_proto("UNKNOWN_OPCODE"))
+    out.emit(" {\n")
+    out.emit(
+        '_PyErr_Format(tstate, PyExc_SystemError, "%U:%d: unknown opcode %d", '
+        "_PyFrame_GetCode(frame)->co_filename, "
+        "PyUnstable_InterpreterFrame_GetLine(frame), opcode);\n"
+    )
+    out.emit("JUMP_TO_LABEL(error);\n")
+    out.emit("}\n")
+    out.emit("\n")
+
+    # Emit the dispatch table.
+    out.emit("static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {\n")
+    for name, op in sorted(analysis.opmap.items()):
+        if op < 256:
+            out.emit(f"[{name}] = _TAIL_CALL_{name},\n")
+    named_values = analysis.opmap.values()
+    for rest in range(256):
+        if rest not in named_values:
+            out.emit(f"[{rest}] = _TAIL_CALL_UNKNOWN_OPCODE,\n")
+    out.emit("};\n")
+    out.emit("#endif /* Py_TAIL_CALL_INTERP */\n")
 
 
 arg_parser = argparse.ArgumentParser(
@@ -52,3 +99,4 @@ def write_opcode_targets(analysis: Analysis, out: CWriter) -> None:
     with open(args.output, "w") as outfile:
         out = CWriter(outfile, 0, False)
         write_opcode_targets(data, out)
+        write_tailcall_dispatch_table(data, out)
@@ -128,6 +128,36 @@ def uses_this(inst: Instruction) -> bool:
     return False
 
 
+def write_second(inst: Instruction, emitter: Emitter) -> None:
+    """Write the second half of a superinstruction.
+
+    The second instruction is still in the next code unit, so it is
+    executed in place unless instrumentation has replaced it."""
+    out = emitter.out
+    out.emit(f"// {inst.name}\n")
+    out.emit(f"if (next_instr->op.code != {inst.name}) {{\n")
+    out.emit("DISPATCH();\n")
+    out.emit("}\n")
+    out.emit("{\n")
+    if inst.properties.oparg:
+        out.emit("oparg = next_instr->op.arg;\n")
+    out.emit("frame->instr_ptr = next_instr;\n")
+    out.emit(f"next_instr += {inst.size};\n")
+    out.emit(f"INSTRUCTION_STATS({inst.name});\n")
+    declare_variables(inst, out)
+    offset = 1
+    stack = Stack()
+    insert_braces = len([p for p in inst.parts if isinstance(p, Uop)]) > 1
+    for part in inst.parts:
+        offset, stack = write_uop(part, emitter, offset, stack, inst, insert_braces)
+    out.start_line()
+    stack.flush(out)
+    if not inst.parts[-1].properties.always_exits:
+        out.emit("DISPATCH();\n")
+    out.start_line()
+    out.emit("}\n")
+
+
 def generate_tier1(
     filenames: list[str], analysis: Analysis, outfile: TextIO, lines: bool
 ) -> None:
@@ -177,14 +207,31 @@ def generate_tier1(
         out.start_line()
 
         stack.flush(out)
-        if not inst.parts[-1].properties.always_exits:
+        if inst.second is not None:
+            write_second(inst.second, emitter)
+        elif not inst.parts[-1].properties.always_exits:
             out.emit("DISPATCH();\n")
         out.start_line()
         out.emit("}")
         out.emit("\n")
+    generate_tier1_labels(analysis, emitter)
     outfile.write(FOOTER)
 
 
+def generate_tier1_labels(analysis: Analysis, emitter: Emitter) -> None:
+    if not analysis.labels:
+        return
+    emitter.emit("\n")
+    emitter.emit("/* BEGIN LABELS */\n")
+    for name, label in analysis.labels.items():
+        emitter.emit("\n")
+        emitter.emit(f"LABEL({name})\n")
+        emitter.emit_label(label)
+        emitter.emit("\n")
+    emitter.emit("\n")
+    emitter.emit("/* END LABELS */\n")
+
+
 arg_parser = argparse.ArgumentParser(
     description="Generate the code for the interpreter switch.",
     formatter_class=argparse.ArgumentDefaultsHelpFormatter,
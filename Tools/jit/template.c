@@ -1,6 +1,7 @@
 #include "Python.h"
 
 #include "pycore_backoff.h"
+#include "pycore_bytesobject.h"
 #include "pycore_call.h"
 #include "pycore_ceval.h"
 #include "pycore_cell.h"